@@ -30,10 +30,37 @@ namespace uscp::memetic
 	{
 		position_serial stopping_criterion;
 		uscp::rwls::position_serial rwls_stopping_criterion;
+		size_t population_size = 2;
+		size_t islands_number = 1;
+		size_t migration_interval = 10;
+		bool steady_state = false;
+		size_t lower_bound = 0;
 	};
 	void to_json(nlohmann::json& j, const config_serial& serial);
 	void from_json(const nlohmann::json& j, config_serial& serial);
 
+	struct operator_statistics_serial final
+	{
+		std::string name;
+		size_t uses = 0;
+		size_t improvement = 0;
+		double time = 0;
+	};
+	void to_json(nlohmann::json& j, const operator_statistics_serial& serial);
+	void from_json(const nlohmann::json& j, operator_statistics_serial& serial);
+
+	struct phases_time_serial final
+	{
+		double rwls = 0;
+		double crossover = 0;
+		double wcrossover = 0;
+		double restarts = 0;
+		double logging = 0;
+		double other = 0;
+	};
+	void to_json(nlohmann::json& j, const phases_time_serial& serial);
+	void from_json(const nlohmann::json& j, phases_time_serial& serial);
+
 	struct report_serial final
 	{
 		solution_serial solution_final;
@@ -43,6 +70,11 @@ namespace uscp::memetic
 		config_serial solve_config;
 		std::string crossover_operator;
 		std::string wcrossover_operator;
+		size_t found_by_island = 0;
+		std::vector<operator_statistics_serial> crossovers_statistics;
+		std::vector<operator_statistics_serial> wcrossovers_statistics;
+		phases_time_serial phases;
+		std::vector<phases_time_serial> generations_phases;
 	};
 	void to_json(nlohmann::json& j, const report_serial& serial);
 	void from_json(const nlohmann::json& j, report_serial& serial);
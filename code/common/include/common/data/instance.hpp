@@ -42,6 +42,7 @@ namespace uscp::problem
 		size_t points_number = 0;
 		size_t subsets_number = 0;
 		std::vector<size_t> points_covered;
+		std::vector<size_t> points_dominated;
 		std::vector<size_t> subsets_dominated;
 		std::vector<size_t> subsets_included;
 
@@ -58,6 +59,7 @@ namespace uscp::problem
 	{
 		// relative to full solution
 		dynamic_bitset<> points_covered;
+		dynamic_bitset<> points_dominated;
 		dynamic_bitset<> subsets_dominated;
 		dynamic_bitset<> subsets_included;
 
@@ -67,6 +69,9 @@ namespace uscp::problem
 		reduction& operator=(const reduction&) = default;
 		reduction& operator=(reduction&&) noexcept = default;
 
+		[[nodiscard]] dynamic_bitset<> removed_points() const noexcept;
+		[[nodiscard]] dynamic_bitset<> removed_subsets() const noexcept;
+
 		[[nodiscard]] reduction_serial serialize() const noexcept;
 		bool load(const reduction_serial& serial) noexcept;
 	};
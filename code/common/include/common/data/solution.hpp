@@ -14,6 +14,7 @@
 #include <nlohmann/json.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <ostream>
 
@@ -33,6 +34,8 @@ namespace uscp
 		dynamic_bitset<> selected_subsets;
 		dynamic_bitset<> covered_points;
 		bool cover_all_points;
+		// zobrist hash of selected_subsets: xor of the selected subsets keys
+		uint64_t hash;
 
 		explicit solution(const problem::instance& problem);
 		solution(const solution&) = default;
@@ -40,7 +43,25 @@ namespace uscp
 		solution& operator=(const solution& other);
 		solution& operator=(solution&& other) noexcept;
 
+		// also compute the hash
 		void compute_cover() noexcept;
+		void compute_hash() noexcept;
+
+		// hashes compared first, the subsets are only compared if the hashes are equal
+		[[nodiscard, gnu::hot]] bool same_subsets(const solution& other) const noexcept
+		{
+			return hash == other.hash && selected_subsets == other.selected_subsets;
+		}
+
+		// update the hash when the subset is added or removed
+		[[nodiscard, gnu::hot]] static uint64_t subset_hash(size_t subset) noexcept
+		{
+			// splitmix64 finalizer of the subset number, no table to store
+			uint64_t z = static_cast<uint64_t>(subset) + 0x9e3779b97f4a7c15;
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+			return z ^ (z >> 31);
+		}
 
 		[[nodiscard]] solution_serial serialize() const noexcept;
 		bool load(const solution_serial& serial) noexcept;
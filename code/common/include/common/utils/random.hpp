@@ -9,10 +9,77 @@
 #define USCP_COMMON_RANDOM_HPP
 
 #include <random>
+#include <array>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
 
 namespace uscp
 {
-	using random_engine = std::mt19937;
-}
+	// xoshiro256** (Blackman and Vigna): 32 bytes of state instead of 2.5KB for std::mt19937,
+	// jumpable to split non-overlapping streams for parallel workers
+	class xoshiro256ss final
+	{
+	public:
+		typedef uint64_t result_type;
+		static constexpr result_type default_seed = 5489u;
+
+		explicit xoshiro256ss(result_type seed = default_seed) noexcept;
+		xoshiro256ss(const xoshiro256ss&) = default;
+		xoshiro256ss(xoshiro256ss&&) noexcept = default;
+		xoshiro256ss& operator=(const xoshiro256ss& other) = default;
+		xoshiro256ss& operator=(xoshiro256ss&& other) noexcept = default;
+
+		void seed(result_type seed) noexcept;
+
+		[[nodiscard]] static constexpr result_type min() noexcept
+		{
+			return std::numeric_limits<result_type>::min();
+		}
+		[[nodiscard]] static constexpr result_type max() noexcept
+		{
+			return std::numeric_limits<result_type>::max();
+		}
+
+		[[gnu::hot]] result_type operator()() noexcept
+		{
+			const uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+			const uint64_t t = m_state[1] << 17;
+			m_state[2] ^= m_state[0];
+			m_state[3] ^= m_state[1];
+			m_state[1] ^= m_state[2];
+			m_state[0] ^= m_state[3];
+			m_state[2] ^= t;
+			m_state[3] = rotl(m_state[3], 45);
+			return result;
+		}
+
+		// equivalent to 2^128 calls
+		void jump() noexcept;
+
+		void discard(unsigned long long z) noexcept;
+
+		bool operator==(const xoshiro256ss& other) const noexcept;
+		bool operator!=(const xoshiro256ss& other) const noexcept;
+
+	private:
+		[[nodiscard]] static constexpr uint64_t rotl(uint64_t x, int k) noexcept
+		{
+			return (x << k) | (x >> (64 - k));
+		}
+
+		std::array<uint64_t, 4> m_state;
+	};
+
+	using random_engine = xoshiro256ss;
+
+	// uniform integer in [0, range), Lemire's nearly divisionless method, range > 0
+	[[nodiscard, gnu::hot]] uint64_t random_index(random_engine& generator, uint64_t range) noexcept;
+
+	// independent generators for parallel workers: copies of generator, jumped between each one
+	[[nodiscard]] std::vector<random_engine> split(random_engine& generator,
+	                                               size_t streams_number) noexcept;
+} // namespace uscp
 
 #endif //USCP_COMMON_RANDOM_HPP
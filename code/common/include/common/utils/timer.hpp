@@ -21,9 +21,10 @@ public:
 
 	[[nodiscard]] double elapsed() const noexcept;
 	void reset() noexcept;
+	void reset(double elapsed) noexcept; // as if started elapsed seconds ago
 
 private:
-	std::chrono::time_point<std::chrono::system_clock, std::chrono::duration<double>> start;
+	std::chrono::time_point<std::chrono::steady_clock, std::chrono::duration<double>> start;
 };
 
 #endif //USCP_TIMER_HPP
@@ -28,6 +28,11 @@ void uscp::memetic::to_json(nlohmann::json& j, const uscp::memetic::config_seria
 	j = nlohmann::json{
 	  {"stopping_criterion", serial.stopping_criterion},
 	  {"rwls_stopping_criterion", serial.rwls_stopping_criterion},
+	  {"population_size", serial.population_size},
+	  {"islands_number", serial.islands_number},
+	  {"migration_interval", serial.migration_interval},
+	  {"steady_state", serial.steady_state},
+	  {"lower_bound", serial.lower_bound},
 	};
 }
 
@@ -35,6 +40,61 @@ void uscp::memetic::from_json(const nlohmann::json& j, uscp::memetic::config_ser
 {
 	j.at("stopping_criterion").get_to(serial.stopping_criterion);
 	j.at("rwls_stopping_criterion").get_to(serial.rwls_stopping_criterion);
+
+	// support for versions with a fixed population of 2 individuals
+	serial.population_size = j.value<size_t>("population_size", 2);
+
+	// support for versions without island model
+	serial.islands_number = j.value<size_t>("islands_number", 1);
+	serial.migration_interval = j.value<size_t>("migration_interval", 10);
+
+	// support for versions without steady-state mode
+	serial.steady_state = j.value<bool>("steady_state", false);
+
+	// support for versions without lower bound
+	serial.lower_bound = j.value<size_t>("lower_bound", 0);
+}
+
+void uscp::memetic::to_json(nlohmann::json& j,
+                            const uscp::memetic::operator_statistics_serial& serial)
+{
+	j = nlohmann::json{
+	  {"name", serial.name},
+	  {"uses", serial.uses},
+	  {"improvement", serial.improvement},
+	  {"time", serial.time},
+	};
+}
+
+void uscp::memetic::from_json(const nlohmann::json& j,
+                              uscp::memetic::operator_statistics_serial& serial)
+{
+	j.at("name").get_to(serial.name);
+	j.at("uses").get_to(serial.uses);
+	j.at("improvement").get_to(serial.improvement);
+	j.at("time").get_to(serial.time);
+}
+
+void uscp::memetic::to_json(nlohmann::json& j, const uscp::memetic::phases_time_serial& serial)
+{
+	j = nlohmann::json{
+	  {"rwls", serial.rwls},
+	  {"crossover", serial.crossover},
+	  {"wcrossover", serial.wcrossover},
+	  {"restarts", serial.restarts},
+	  {"logging", serial.logging},
+	  {"other", serial.other},
+	};
+}
+
+void uscp::memetic::from_json(const nlohmann::json& j, uscp::memetic::phases_time_serial& serial)
+{
+	j.at("rwls").get_to(serial.rwls);
+	j.at("crossover").get_to(serial.crossover);
+	j.at("wcrossover").get_to(serial.wcrossover);
+	j.at("restarts").get_to(serial.restarts);
+	j.at("logging").get_to(serial.logging);
+	j.at("other").get_to(serial.other);
 }
 
 void uscp::memetic::to_json(nlohmann::json& j, const uscp::memetic::report_serial& serial)
@@ -47,6 +107,11 @@ void uscp::memetic::to_json(nlohmann::json& j, const uscp::memetic::report_seria
 	  {"solve_config", serial.solve_config},
 	  {"crossover_operator", serial.crossover_operator},
 	  {"wcrossover_operator", serial.wcrossover_operator},
+	  {"found_by_island", serial.found_by_island},
+	  {"crossovers_statistics", serial.crossovers_statistics},
+	  {"wcrossovers_statistics", serial.wcrossovers_statistics},
+	  {"phases", serial.phases},
+	  {"generations_phases", serial.generations_phases},
 	};
 }
 
@@ -61,4 +126,18 @@ void uscp::memetic::from_json(const nlohmann::json& j, uscp::memetic::report_ser
 	// support for versions after de859b75cec4bb457af200479b4deb071df256e9
 	serial.points_weights_final = j.value<std::vector<long long>>("points_weights_final", {});
 	serial.wcrossover_operator = j.value<std::string>("wcrossover_operator", {});
+
+	// support for versions without island model
+	serial.found_by_island = j.value<size_t>("found_by_island", 0);
+
+	// support for versions without operators statistics
+	serial.crossovers_statistics =
+	  j.value<std::vector<operator_statistics_serial>>("crossovers_statistics", {});
+	serial.wcrossovers_statistics =
+	  j.value<std::vector<operator_statistics_serial>>("wcrossovers_statistics", {});
+
+	// support for versions without phases time
+	serial.phases = j.value<phases_time_serial>("phases", {});
+	serial.generations_phases =
+	  j.value<std::vector<phases_time_serial>>("generations_phases", {});
 }
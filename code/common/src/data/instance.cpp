@@ -34,6 +34,7 @@ void uscp::problem::to_json(nlohmann::json& j, const uscp::problem::reduction_se
 	  {"points_number", serial.points_number},
 	  {"subsets_number", serial.subsets_number},
 	  {"points_covered", serial.points_covered},
+	  {"points_dominated", serial.points_dominated},
 	  {"subsets_dominated", serial.subsets_dominated},
 	  {"subsets_included", serial.subsets_included},
 	};
@@ -44,6 +45,7 @@ void uscp::problem::from_json(const nlohmann::json& j, uscp::problem::reduction_
 	j.at("points_number").get_to(serial.points_number);
 	j.at("subsets_number").get_to(serial.subsets_number);
 	j.at("points_covered").get_to(serial.points_covered);
+	j.at("points_dominated").get_to(serial.points_dominated);
 	j.at("subsets_dominated").get_to(serial.subsets_dominated);
 	j.at("subsets_included").get_to(serial.subsets_included);
 }
@@ -58,6 +60,10 @@ uscp::problem::reduction_serial uscp::problem::reduction::serialize() const noex
 	serial.points_covered.reserve(points_covered.count());
 	points_covered.iterate_bits_on([&](size_t bit_on) { serial.points_covered.push_back(bit_on); });
 
+	serial.points_dominated.reserve(points_dominated.count());
+	points_dominated.iterate_bits_on(
+	  [&](size_t bit_on) { serial.points_dominated.push_back(bit_on); });
+
 	serial.subsets_dominated.reserve(subsets_dominated.count());
 	subsets_dominated.iterate_bits_on(
 	  [&](size_t bit_on) { serial.subsets_dominated.push_back(bit_on); });
@@ -77,6 +83,13 @@ bool uscp::problem::reduction::load(const uscp::problem::reduction_serial& seria
 		points_covered.set(point);
 	}
 
+	points_dominated.resize(serial.points_number);
+	points_dominated.reset();
+	for(size_t point: serial.points_dominated)
+	{
+		points_dominated.set(point);
+	}
+
 	subsets_dominated.resize(serial.subsets_number);
 	subsets_dominated.reset();
 	for(size_t subset: serial.subsets_dominated)
@@ -96,11 +109,22 @@ bool uscp::problem::reduction::load(const uscp::problem::reduction_serial& seria
 
 uscp::problem::reduction::reduction(size_t points_number, size_t subsets_number) noexcept
   : points_covered(points_number)
+  , points_dominated(points_number)
   , subsets_dominated(subsets_number)
   , subsets_included(subsets_number)
 {
 }
 
+dynamic_bitset<> uscp::problem::reduction::removed_points() const noexcept
+{
+	return points_covered | points_dominated;
+}
+
+dynamic_bitset<> uscp::problem::reduction::removed_subsets() const noexcept
+{
+	return subsets_dominated | subsets_included;
+}
+
 uscp::problem::reduction_info::reduction_info(
   const uscp::problem::instance* parent_instance_) noexcept
   : parent_instance(parent_instance_)
@@ -30,6 +30,7 @@ uscp::solution::solution(const uscp::problem::instance& problem_)
   , selected_subsets(problem_.subsets_number)
   , covered_points(problem_.points_number)
   , cover_all_points(false)
+  , hash(0)
 {
 }
 
@@ -39,6 +40,7 @@ uscp::solution& uscp::solution::operator=(const uscp::solution& other)
 	selected_subsets = other.selected_subsets;
 	covered_points = other.covered_points;
 	cover_all_points = other.cover_all_points;
+	hash = other.hash;
 	return *this;
 }
 
@@ -48,6 +50,7 @@ uscp::solution& uscp::solution::operator=(uscp::solution&& other) noexcept
 	selected_subsets = std::move(other.selected_subsets);
 	covered_points = std::move(other.covered_points);
 	cover_all_points = other.cover_all_points;
+	hash = other.hash;
 	return *this;
 }
 
@@ -57,15 +60,25 @@ void uscp::solution::compute_cover() noexcept
 	assert(covered_points.size() == problem.points_number);
 
 	covered_points.reset();
+	hash = 0;
 	size_t selected_subset = selected_subsets.find_first();
 	while(selected_subset != dynamic_bitset<>::npos)
 	{
 		covered_points |= problem.subsets_points[selected_subset];
+		hash ^= subset_hash(selected_subset);
 		selected_subset = selected_subsets.find_next(selected_subset);
 	}
 	cover_all_points = covered_points.all();
 }
 
+void uscp::solution::compute_hash() noexcept
+{
+	assert(selected_subsets.size() == problem.subsets_number);
+
+	hash = 0;
+	selected_subsets.iterate_bits_on([&](size_t bit_on) noexcept { hash ^= subset_hash(bit_on); });
+}
+
 uscp::solution_serial uscp::solution::serialize() const noexcept
 {
 	solution_serial serial;
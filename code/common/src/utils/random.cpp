@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "common/utils/random.hpp"
+
+#include <cassert>
+
+namespace
+{
+	uint64_t splitmix64(uint64_t& state) noexcept
+	{
+		uint64_t z = (state += 0x9e3779b97f4a7c15);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+		return z ^ (z >> 31);
+	}
+
+	// 64 bits x 64 bits -> 128 bits multiplication
+	void multiply(uint64_t a, uint64_t b, uint64_t& high, uint64_t& low) noexcept
+	{
+#if defined(__SIZEOF_INT128__)
+		__extension__ typedef unsigned __int128 uint128_t; // not ISO C++: no -Wpedantic warning
+		const uint128_t product = static_cast<uint128_t>(a) * b;
+		high = static_cast<uint64_t>(product >> 64);
+		low = static_cast<uint64_t>(product);
+#else
+		const uint64_t a_low = a & 0xffffffff;
+		const uint64_t a_high = a >> 32;
+		const uint64_t b_low = b & 0xffffffff;
+		const uint64_t b_high = b >> 32;
+		const uint64_t low_low = a_low * b_low;
+		const uint64_t high_low = a_high * b_low;
+		const uint64_t low_high = a_low * b_high;
+		const uint64_t high_high = a_high * b_high;
+		const uint64_t cross = (low_low >> 32) + (high_low & 0xffffffff) + low_high;
+		high = high_high + (high_low >> 32) + (cross >> 32);
+		low = (cross << 32) | (low_low & 0xffffffff);
+#endif
+	}
+} // namespace
+
+uscp::xoshiro256ss::xoshiro256ss(result_type seed) noexcept: m_state()
+{
+	this->seed(seed);
+}
+
+void uscp::xoshiro256ss::seed(result_type seed) noexcept
+{
+	// state initialized with splitmix64 as recommended by the authors (never all zeros)
+	uint64_t splitmix_state = seed;
+	for(uint64_t& state: m_state)
+	{
+		state = splitmix64(splitmix_state);
+	}
+}
+
+void uscp::xoshiro256ss::jump() noexcept
+{
+	static constexpr std::array<uint64_t, 4> JUMP = {
+	  0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c};
+
+	std::array<uint64_t, 4> state = {0, 0, 0, 0};
+	for(uint64_t jump: JUMP)
+	{
+		for(int b = 0; b < 64; ++b)
+		{
+			if(jump & (uint64_t(1) << b))
+			{
+				for(size_t i = 0; i < state.size(); ++i)
+				{
+					state[i] ^= m_state[i];
+				}
+			}
+			operator()();
+		}
+	}
+	m_state = state;
+}
+
+void uscp::xoshiro256ss::discard(unsigned long long z) noexcept
+{
+	for(unsigned long long i = 0; i < z; ++i)
+	{
+		operator()();
+	}
+}
+
+bool uscp::xoshiro256ss::operator==(const xoshiro256ss& other) const noexcept
+{
+	return m_state == other.m_state;
+}
+
+bool uscp::xoshiro256ss::operator!=(const xoshiro256ss& other) const noexcept
+{
+	return m_state != other.m_state;
+}
+
+uint64_t uscp::random_index(random_engine& generator, uint64_t range) noexcept
+{
+	assert(range > 0);
+	uint64_t high = 0;
+	uint64_t low = 0;
+	multiply(generator(), range, high, low);
+	if(low < range)
+	{
+		// reject the values that would bias the result, the division is rarely needed
+		const uint64_t threshold = (0 - range) % range;
+		while(low < threshold)
+		{
+			multiply(generator(), range, high, low);
+		}
+	}
+	return high;
+}
+
+std::vector<uscp::random_engine> uscp::split(random_engine& generator,
+                                             size_t streams_number) noexcept
+{
+	std::vector<random_engine> streams;
+	streams.reserve(streams_number);
+	for(size_t i = 0; i < streams_number; ++i)
+	{
+		streams.push_back(generator);
+		generator.jump();
+	}
+	return streams;
+}
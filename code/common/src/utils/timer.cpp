@@ -7,17 +7,22 @@
 //
 #include "common/utils/timer.hpp"
 
-timer::timer() noexcept: start(std::chrono::system_clock::now())
+timer::timer() noexcept: start(std::chrono::steady_clock::now())
 {
 }
 
 double timer::elapsed() const noexcept
 {
-	const std::chrono::duration<double> elapsed = std::chrono::system_clock::now() - start;
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
 	return elapsed.count();
 }
 
 void timer::reset() noexcept
 {
-	start = std::chrono::system_clock::now();
+	start = std::chrono::steady_clock::now();
+}
+
+void timer::reset(double elapsed) noexcept
+{
+	start = std::chrono::steady_clock::now() - std::chrono::duration<double>(elapsed);
 }
@@ -59,6 +59,8 @@ public:
 			  "figure_weights.tex";
 			static constexpr const std::string_view MEMETIC_COMPARISON_TABLE_TEMPLATE_FILE =
 			  "comparison.tex";
+			static constexpr const std::string_view MEMETIC_PHASES_TABLE_TEMPLATE_FILE =
+			  "memetic_phases.tex";
 
 			// Output files
 			static constexpr const std::string_view RWLS_WEIGHTS_CSV_OUTPUT_FILE_PREFIX =
@@ -109,6 +111,7 @@ public:
 	void generate_rwls_stats(bool enable) noexcept;
 	void generate_rwls_weights(bool enable) noexcept;
 	void generate_memetic_comparisons(bool enable) noexcept;
+	void generate_memetic_phases(bool enable) noexcept;
 
 	bool generate_document() noexcept;
 
@@ -197,6 +200,22 @@ private:
 	};
 	friend void to_json(nlohmann::json& j, const printer::memetic_comparison& serial);
 
+	// average share of the memetic time spent in each phase
+	struct memetic_phases_stat final
+	{
+		instance_info instance;
+		bool exist = false;
+		double rwls = 0;
+		double crossover = 0;
+		double wcrossover = 0;
+		double restarts = 0;
+		double logging = 0;
+		double other = 0;
+		double time = 0;
+		size_t repetitions = 0;
+	};
+	friend void to_json(nlohmann::json& j, const printer::memetic_phases_stat& serial);
+
 	struct rwls_weights_stats final
 	{
 		instance_info instance;
@@ -226,6 +245,7 @@ private:
 	bool m_generate_rwls_stats;
 	bool m_generate_rwls_weights;
 	bool m_generate_memetic_comparisons;
+	bool m_generate_memetic_phases;
 
 	template<typename... Report>
 	friend std::vector<instance_info> gather_instances_infos_(
@@ -244,6 +264,7 @@ private:
 	bool generate_memetic_comparisons_tables(
 	  const std::vector<instance_info>& instances,
 	  std::vector<std::string>& generated_tables_files) noexcept;
+	bool generate_memetic_phases_table(const std::vector<instance_info>& instances) noexcept;
 
 	[[nodiscard]] std::string generate_output_folder_name(std::string_view output_prefix) const
 	  noexcept;
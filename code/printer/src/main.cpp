@@ -33,6 +33,7 @@ int main(int argc, char* argv[])
 	std::basic_regex<char> validation_regex;
 	bool rwls_stats = false;
 	bool memetic_comparisons = false;
+	bool memetic_phases = false;
 	bool rwls_weights = false;
 	try
 	{
@@ -90,6 +91,11 @@ int main(int argc, char* argv[])
 		  cxxopts::Option("memetic_comparisons",
 		                  "Generate memetic comparison tables",
 		                  cxxopts::value<bool>(memetic_comparisons)->default_value("false")));
+		options.add_option(
+		  "",
+		  cxxopts::Option("memetic_phases",
+		                  "Generate memetic phases time table",
+		                  cxxopts::value<bool>(memetic_phases)->default_value("false")));
 		cxxopts::ParseResult result = options.parse(argc, argv);
 
 		if(result.count("help"))
@@ -147,6 +153,7 @@ int main(int argc, char* argv[])
 		printer.generate_rwls_stats(rwls_stats);
 		printer.generate_rwls_weights(rwls_weights);
 		printer.generate_memetic_comparisons(memetic_comparisons);
+		printer.generate_memetic_phases(memetic_phases);
 		std::deque<std::string> paths(std::cbegin(input_folder_files),
 		                              std::cend(input_folder_files));
 		const timer timer;
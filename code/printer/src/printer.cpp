@@ -17,6 +17,7 @@
 #include <iterator>
 #include <functional>
 #include <iomanip>
+#include <array>
 
 namespace
 {
@@ -107,6 +108,7 @@ printer::printer(std::string_view output_prefix) noexcept
   , m_generate_rwls_stats(false)
   , m_generate_rwls_weights(false)
   , m_generate_memetic_comparisons(false)
+  , m_generate_memetic_phases(false)
 {
 	m_environment.set_statement(std::string(config::inja::STATEMENT_OPEN),
 	                            std::string(config::inja::STATEMENT_CLOSE));
@@ -198,6 +200,11 @@ void printer::generate_memetic_comparisons(bool enable) noexcept
 	m_generate_memetic_comparisons = enable;
 }
 
+void printer::generate_memetic_phases(bool enable) noexcept
+{
+	m_generate_memetic_phases = enable;
+}
+
 bool printer::generate_document() noexcept
 {
 	LOGGER->info("Started generating document");
@@ -262,6 +269,15 @@ bool printer::generate_document() noexcept
 		}
 	}
 
+	if(m_generate_memetic_phases)
+	{
+		if(!generate_memetic_phases_table(instances))
+		{
+			LOGGER->warn("Failed to generate memetic phases table");
+			return false;
+		}
+	}
+
 	// generate data
 	nlohmann::json data;
 	data["title"] = config::info::DOCUMENT_TITLE;
@@ -272,6 +288,7 @@ bool printer::generate_document() noexcept
 	data["date"] = now_txt.str();
 	data["rwls_stats"] = m_generate_rwls_stats;
 	data["memetic_comparisons"] = m_generate_memetic_comparisons;
+	data["memetic_phases"] = m_generate_memetic_phases;
 	data["rwls_weights"] = m_generate_rwls_weights;
 	data["memetic_comparisons_tables_files"] = memetic_comparisons_tables_files;
 	data["rwls_weights_plots_files"] = rwls_weights_plots_files;
@@ -925,6 +942,68 @@ bool printer::generate_memetic_comparisons_tables(
 	return true;
 }
 
+bool printer::generate_memetic_phases_table(const std::vector<instance_info>& instances) noexcept
+{
+	const timer timer;
+
+	// generate data
+	std::vector<memetic_phases_stat> stats;
+	stats.reserve(instances.size());
+	for(const instance_info& instance: instances)
+	{
+		memetic_phases_stat stat;
+		stat.instance = instance;
+
+		const auto [memetic_begin, memetic_end] = std::equal_range(std::begin(m_memetic_reports),
+		                                                           std::end(m_memetic_reports),
+		                                                           instance.name,
+		                                                           memetic_report_less);
+		for(auto it = memetic_begin; it < memetic_end; ++it)
+		{
+			const uscp::memetic::phases_time_serial& phases = it->phases;
+			const double total = phases.rwls + phases.crossover + phases.wcrossover
+			                     + phases.restarts + phases.logging + phases.other;
+			if(total <= 0)
+			{
+				// no phases time information
+				continue;
+			}
+
+			stat.exist = true;
+			++stat.repetitions;
+			const double factor = 1.0 / stat.repetitions;
+			stat.rwls += factor * (phases.rwls / total - stat.rwls);
+			stat.crossover += factor * (phases.crossover / total - stat.crossover);
+			stat.wcrossover += factor * (phases.wcrossover / total - stat.wcrossover);
+			stat.restarts += factor * (phases.restarts / total - stat.restarts);
+			stat.logging += factor * (phases.logging / total - stat.logging);
+			stat.other += factor * (phases.other / total - stat.other);
+			stat.time += factor * (it->ended_at.time - stat.time);
+		}
+
+		if(stat.exist)
+		{
+			stats.push_back(std::move(stat));
+		}
+	}
+	nlohmann::json data;
+	data["stats"] = std::move(stats);
+
+	// generate table
+	const std::string template_file =
+	  concat(tables_template_folder, config::partial::MEMETIC_PHASES_TABLE_TEMPLATE_FILE);
+	const std::string output_file =
+	  concat(tables_output_folder, config::partial::MEMETIC_PHASES_TABLE_TEMPLATE_FILE);
+	if(!write_and_save(template_file, data, output_file))
+	{
+		LOGGER->error("Failed to generate memetic phases table");
+		return false;
+	}
+
+	LOGGER->info("Generated memetic phases table in {}", timer.elapsed());
+	return true;
+}
+
 std::string printer::generate_output_folder_name(std::string_view output_prefix) const noexcept
 {
 	std::ostringstream output_folder_stream;
@@ -1059,6 +1138,38 @@ void to_json(nlohmann::json& j, const printer::memetic_comparison& serial)
 	};
 }
 
+void to_json(nlohmann::json& j, const printer::memetic_phases_stat& serial)
+{
+	// bar: cumulated shares, boundaries of the stacked bar parts
+	const std::array<double, 6> shares = {serial.rwls,
+	                                      serial.crossover,
+	                                      serial.wcrossover,
+	                                      serial.restarts,
+	                                      serial.logging,
+	                                      serial.other};
+	nlohmann::json bar = nlohmann::json::array();
+	double from = 0;
+	for(double share: shares)
+	{
+		bar.push_back(nlohmann::json{{"from", from}, {"to", from + share}});
+		from += share;
+	}
+
+	j = nlohmann::json{
+	  {"instance", serial.instance},
+	  {"exist", serial.exist},
+	  {"rwls", serial.rwls},
+	  {"crossover", serial.crossover},
+	  {"wcrossover", serial.wcrossover},
+	  {"restarts", serial.restarts},
+	  {"logging", serial.logging},
+	  {"other", serial.other},
+	  {"bar", std::move(bar)},
+	  {"time", serial.time},
+	  {"repetitions", serial.repetitions},
+	};
+}
+
 void to_json(nlohmann::json& j, const printer::rwls_weights_stats& serial)
 {
 	j = nlohmann::json{
@@ -0,0 +1,246 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_ADAPTIVE_HPP
+#define USCP_ADAPTIVE_HPP
+
+#include "common/data/instance.hpp"
+#include "common/utils/random.hpp"
+
+#include <cstddef>
+#include <string_view>
+#include <array>
+#include <tuple>
+#include <vector>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace uscp::adaptive
+{
+	struct arm_statistics final
+	{
+		size_t uses = 0;
+		size_t improvement = 0; // subsets removed from the best parent by the offspring RWLS
+		double time = 0;        // crossover and offspring RWLS time, cumulated over the threads
+	};
+
+	// UCB1 on the improvement per second of the arms
+	class ucb final
+	{
+	public:
+		explicit ucb(size_t arms_number) noexcept;
+		ucb(const ucb&) = default;
+		ucb(ucb&&) noexcept = default;
+		ucb& operator=(const ucb& other) = default;
+		ucb& operator=(ucb&& other) noexcept = default;
+
+		// arms never used first, then the highest upper confidence bound
+		[[nodiscard]] size_t select() const noexcept;
+		// always select this arm
+		void pin(size_t arm) noexcept;
+		void update(size_t arm, size_t improvement, double time) noexcept;
+
+		[[nodiscard]] const std::vector<arm_statistics>& statistics() const noexcept;
+		bool load(const std::vector<arm_statistics>& statistics) noexcept;
+
+	private:
+		std::vector<arm_statistics> m_arms;
+		std::optional<size_t> m_pinned;
+	};
+
+	// several crossovers or weights crossovers, the one applied is chosen for each call
+	template<typename... Operators>
+	class pool final
+	{
+	public:
+		static constexpr size_t operators_number = sizeof...(Operators);
+
+		explicit pool(const uscp::problem::instance& problem) noexcept
+		  : m_operators(Operators(problem)...)
+		{
+		}
+		pool(const pool&) = default;
+		pool(pool&&) noexcept = default;
+		pool& operator=(const pool& other) = delete;
+		pool& operator=(pool&& other) noexcept = delete;
+
+		template<typename T>
+		T apply1(size_t i_operator, const T& a, const T& b, random_engine& generator) noexcept
+		{
+			return visit(i_operator,
+			             [&](auto& operator_) noexcept { return operator_.apply1(a, b, generator); });
+		}
+
+		template<typename T>
+		T apply2(size_t i_operator, const T& a, const T& b, random_engine& generator) noexcept
+		{
+			return visit(i_operator,
+			             [&](auto& operator_) noexcept { return operator_.apply2(a, b, generator); });
+		}
+
+		template<typename T>
+		void apply1(size_t i_operator,
+		            const T& a,
+		            const T& b,
+		            T& child,
+		            random_engine& generator) noexcept
+		{
+			visit(i_operator,
+			      [&](auto& operator_) noexcept { operator_.apply1(a, b, child, generator); });
+		}
+
+		template<typename T>
+		void apply2(size_t i_operator,
+		            const T& a,
+		            const T& b,
+		            T& child,
+		            random_engine& generator) noexcept
+		{
+			visit(i_operator,
+			      [&](auto& operator_) noexcept { operator_.apply2(a, b, child, generator); });
+		}
+
+		[[nodiscard]] static std::string_view operator_name(size_t i_operator) noexcept
+		{
+			static const std::array<std::string_view, operators_number> names = {
+			  Operators::to_string()...};
+			return names[i_operator];
+		}
+
+		[[nodiscard]] static std::string_view to_string() noexcept
+		{
+			return "adaptive";
+		}
+
+	private:
+		template<size_t I = 0, typename Lambda>
+		auto visit(size_t i_operator, Lambda&& lambda) noexcept
+		{
+			if constexpr(I + 1 < operators_number)
+			{
+				if(i_operator != I)
+				{
+					return visit<I + 1>(i_operator, std::forward<Lambda>(lambda));
+				}
+			}
+			return lambda(std::get<I>(m_operators));
+		}
+
+		std::tuple<Operators...> m_operators;
+	};
+
+	template<typename Operator>
+	struct is_pool : std::false_type
+	{
+	};
+
+	template<typename... Operators>
+	struct is_pool<pool<Operators...>> : std::true_type
+	{
+	};
+
+	// a single operator is a pool of one operator
+	template<typename Operator>
+	[[nodiscard]] constexpr size_t operators_number() noexcept
+	{
+		if constexpr(is_pool<Operator>::value)
+		{
+			return Operator::operators_number;
+		}
+		else
+		{
+			return 1;
+		}
+	}
+
+	template<typename Operator>
+	[[nodiscard]] std::string_view operator_name(size_t i_operator) noexcept
+	{
+		if constexpr(is_pool<Operator>::value)
+		{
+			return Operator::operator_name(i_operator);
+		}
+		else
+		{
+			return Operator::to_string();
+		}
+	}
+
+	template<typename Operator, typename T>
+	T apply1(Operator& operator_,
+	         [[maybe_unused]] size_t i_operator,
+	         const T& a,
+	         const T& b,
+	         random_engine& generator) noexcept
+	{
+		if constexpr(is_pool<Operator>::value)
+		{
+			return operator_.apply1(i_operator, a, b, generator);
+		}
+		else
+		{
+			return operator_.apply1(a, b, generator);
+		}
+	}
+
+	template<typename Operator, typename T>
+	T apply2(Operator& operator_,
+	         [[maybe_unused]] size_t i_operator,
+	         const T& a,
+	         const T& b,
+	         random_engine& generator) noexcept
+	{
+		if constexpr(is_pool<Operator>::value)
+		{
+			return operator_.apply2(i_operator, a, b, generator);
+		}
+		else
+		{
+			return operator_.apply2(a, b, generator);
+		}
+	}
+
+	// child written in a caller buffer, for the operators supporting it
+	template<typename Operator, typename T>
+	void apply1(Operator& operator_,
+	            [[maybe_unused]] size_t i_operator,
+	            const T& a,
+	            const T& b,
+	            T& child,
+	            random_engine& generator) noexcept
+	{
+		if constexpr(is_pool<Operator>::value)
+		{
+			operator_.apply1(i_operator, a, b, child, generator);
+		}
+		else
+		{
+			operator_.apply1(a, b, child, generator);
+		}
+	}
+
+	template<typename Operator, typename T>
+	void apply2(Operator& operator_,
+	            [[maybe_unused]] size_t i_operator,
+	            const T& a,
+	            const T& b,
+	            T& child,
+	            random_engine& generator) noexcept
+	{
+		if constexpr(is_pool<Operator>::value)
+		{
+			operator_.apply2(i_operator, a, b, child, generator);
+		}
+		else
+		{
+			operator_.apply2(a, b, child, generator);
+		}
+	}
+} // namespace uscp::adaptive
+
+#endif //USCP_ADAPTIVE_HPP
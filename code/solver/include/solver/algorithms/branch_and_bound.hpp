@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_BRANCH_AND_BOUND_HPP
+#define USCP_BRANCH_AND_BOUND_HPP
+
+#include "common/data/instance.hpp"
+#include "common/data/solution.hpp"
+#include "common/utils/logger.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace uscp::branch_and_bound
+{
+	struct config final
+	{
+		size_t max_nodes = std::numeric_limits<size_t>::max();
+		double max_time = std::numeric_limits<double>::max();
+		size_t lower_bound = 0;          // the search ends when a solution reaches it
+		std::vector<double> multipliers; // of a Lagrangian relaxation, none for no Lagrangian bound
+		size_t threads = 1;              // the tree is split in subtrees explored in parallel
+	};
+
+	struct report final
+	{
+		solution solution_final;
+		bool optimal; // search completed before reaching a limit
+		size_t nodes;
+		double time;
+
+		explicit report(const problem::instance& problem) noexcept;
+		report(const report&) = default;
+		report(report&&) noexcept = default;
+		report& operator=(const report& other) = default;
+		report& operator=(report&& other) noexcept = default;
+	};
+
+	// depth-first search of a minimum cover from the initial solution, branching on the subsets
+	// covering the point with the fewest candidates, bounded by points no subset covers together
+	// and by the Lagrangian relaxation with the multipliers of the config
+	// the best solution found is returned when a limit is reached
+	[[nodiscard, gnu::hot]] report solve(const solution& solution_initial,
+	                                     const config& config = {},
+	                                     std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
+} // namespace uscp::branch_and_bound
+
+#endif //USCP_BRANCH_AND_BOUND_HPP
@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_CORE_HPP
+#define USCP_CORE_HPP
+
+#include "common/data/instance.hpp"
+#include "common/data/solution.hpp"
+#include "common/utils/random.hpp"
+#include "common/utils/logger.hpp"
+#include "solver/algorithms/rwls.hpp"
+
+#include <dynamic_bitset.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace uscp::core
+{
+	// core problem: sub-instance of the subsets with the smallest Lagrangian reduced costs
+	struct config final
+	{
+		size_t subsets_per_point = 5; // subsets with the smallest reduced costs kept per point
+		double pricing_period = 60;   // RWLS time on a core before pricing all the subsets again
+		size_t pricing_iterations = 100; // subgradient iterations of each pricing
+		size_t lower_bound = 0;
+	};
+
+	class pricing final
+	{
+	public:
+		explicit pricing(const problem::instance& problem,
+		                 std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
+		pricing(const pricing&) = default;
+		pricing(pricing&&) noexcept = default;
+		pricing& operator=(const pricing& other) = delete;
+		pricing& operator=(pricing&& other) noexcept = delete;
+
+		// reduced instance with all the points and the non-core subsets dominated,
+		// forced subsets are always part of the core
+		[[nodiscard, gnu::hot]] problem::instance build_core(
+		  const std::vector<double>& multipliers,
+		  const dynamic_bitset<>& forced_subsets,
+		  const config& config) const noexcept;
+
+	private:
+		const problem::instance& m_problem;
+		std::vector<std::vector<size_t>> m_subsets_points;
+		std::vector<std::vector<size_t>> m_points_subsets;
+		const std::shared_ptr<spdlog::logger> m_logger;
+	};
+
+	// solution of the core instance with the same subsets, they must all be in the core
+	[[nodiscard]] solution restrict(const solution& full_solution,
+	                                const problem::instance& core) noexcept;
+
+	// RWLS on cores periodically re-priced, the report is relative to the priced instance
+	[[nodiscard, gnu::hot]] rwls::report improve(
+	  const solution& solution_initial,
+	  const std::vector<double>& multipliers,
+	  random_engine& generator,
+	  rwls::position stopping_criterion,
+	  const config& config = {},
+	  std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
+} // namespace uscp::core
+
+#endif //USCP_CORE_HPP
@@ -15,6 +15,10 @@
 #include <dynamic_bitset.hpp>
 
 #include <string_view>
+#include <array>
+#include <vector>
+#include <numeric>
+#include <cassert>
 
 namespace uscp::crossover
 {
@@ -32,47 +36,85 @@ namespace uscp::crossover
 		               const solution& b,
 		               [[maybe_unused]] random_engine& generator) const noexcept
 		{
-			const solution* current = &a;
-			bool current_is_a = true;
+			// subsets of the parents with their number of uncovered points,
+			// and subsets of the parents covering each point
+			std::vector<size_t> candidates;
+			std::vector<size_t> candidates_gain;
+			std::array<std::vector<size_t>, 2> parents_candidates;
+			std::vector<size_t> points_candidates_begin(problem.points_number + 1, 0);
+			dynamic_bitset<> candidates_subsets = a.selected_subsets;
+			candidates_subsets |= b.selected_subsets;
+			candidates_subsets.iterate_bits_on([&](size_t i_subset) noexcept {
+				if(a.selected_subsets[i_subset])
+				{
+					parents_candidates[0].push_back(candidates.size());
+				}
+				if(b.selected_subsets[i_subset])
+				{
+					parents_candidates[1].push_back(candidates.size());
+				}
+				candidates.push_back(i_subset);
+				candidates_gain.push_back(problem.subsets_points[i_subset].count());
+				problem.subsets_points[i_subset].iterate_bits_on(
+				  [&](size_t i_point) noexcept { ++points_candidates_begin[i_point + 1]; });
+			});
+			std::partial_sum(points_candidates_begin.cbegin(),
+			                 points_candidates_begin.cend(),
+			                 points_candidates_begin.begin());
+			std::vector<size_t> points_candidates(points_candidates_begin.back());
+			std::vector<size_t> points_candidates_end(points_candidates_begin.cbegin(),
+			                                          points_candidates_begin.cend() - 1);
+			for(size_t i_candidate = 0; i_candidate < candidates.size(); ++i_candidate)
+			{
+				problem.subsets_points[candidates[i_candidate]].iterate_bits_on(
+				  [&](size_t i_point) noexcept {
+					  points_candidates[points_candidates_end[i_point]++] = i_candidate;
+				  });
+			}
+
+			// take alternatively the subset of each parent covering the most uncovered points,
+			// a selected subset has no uncovered point left
 			solution solution(problem);
-			while(!solution.cover_all_points)
+			size_t covered_points_number = 0;
+			size_t current = 0;
+			while(covered_points_number < problem.points_number)
 			{
-				size_t max_subset_number = solution.selected_subsets.size(); //invalid initial value
-				dynamic_bitset<> covered_points_with_max_subset(problem.points_number);
-				size_t covered_points_number_with_max_subset = solution.covered_points.count();
-				dynamic_bitset<> new_covered_points;
-				current->selected_subsets.iterate_bits_on([&](size_t i) {
-					if(solution.selected_subsets[i])
+				size_t max_candidate = candidates.size(); //invalid initial value
+				size_t max_gain = 0;
+				for(size_t i_candidate: parents_candidates[current])
+				{
+					if(candidates_gain[i_candidate] > max_gain)
 					{
-						// already selected
-						return;
+						max_candidate = i_candidate;
+						max_gain = candidates_gain[i_candidate];
 					}
+				}
+				// a parent covers all the points
+				assert(max_candidate != candidates.size());
 
-					new_covered_points = solution.covered_points;
-					new_covered_points |= problem.subsets_points[i];
-					const size_t new_covered_points_number = new_covered_points.count();
-					if(new_covered_points_number > covered_points_number_with_max_subset)
+				// update solution and gains
+				const size_t i_subset = candidates[max_candidate];
+				solution.selected_subsets[i_subset].set();
+				solution.hash ^= solution::subset_hash(i_subset);
+				problem.subsets_points[i_subset].iterate_bits_on([&](size_t i_point) noexcept {
+					if(solution.covered_points[i_point])
+					{
+						return;
+					}
+					solution.covered_points[i_point].set();
+					++covered_points_number;
+					for(size_t i = points_candidates_begin[i_point];
+					    i < points_candidates_begin[i_point + 1];
+					    ++i)
 					{
-						max_subset_number = i;
-						covered_points_with_max_subset = new_covered_points;
-						covered_points_number_with_max_subset = new_covered_points_number;
+						--candidates_gain[points_candidates[i]];
 					}
 				});
 
-				// all subset already included or no subset add covered points
-				if(max_subset_number == solution.selected_subsets.size())
-				{
-					continue;
-				}
-				// update solution
-				solution.selected_subsets[max_subset_number].set();
-				solution.covered_points = covered_points_with_max_subset;
-				solution.cover_all_points = solution.covered_points.all();
-
 				// change current
-				current = current_is_a ? &b : &a;
-				current_is_a = !current_is_a;
+				current = 1 - current;
 			}
+			solution.cover_all_points = true;
 			return solution;
 		}
 
@@ -37,6 +37,7 @@ namespace uscp::crossover
 			solution.selected_subsets |= b.selected_subsets;
 			solution.covered_points.set();
 			solution.cover_all_points = true;
+			solution.compute_hash();
 			return solution;
 		}
 
@@ -0,0 +1,89 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_PRUNED_MERGE_HPP
+#define USCP_PRUNED_MERGE_HPP
+
+#include "common/data/instance.hpp"
+#include "common/data/solution.hpp"
+#include "common/utils/random.hpp"
+#include "solver/algorithms/redundancy.hpp"
+
+#include <dynamic_bitset.hpp>
+
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+namespace uscp::crossover
+{
+	struct pruned_merge final
+	{
+		explicit pruned_merge(const uscp::problem::instance& problem_): problem(problem_)
+		{
+		}
+		pruned_merge(const pruned_merge&) = default;
+		pruned_merge(pruned_merge&&) noexcept = default;
+		pruned_merge& operator=(const pruned_merge& other) = delete;
+		pruned_merge& operator=(pruned_merge&& other) noexcept = delete;
+
+		// subsets from both parents without the redundant ones, the subsets only in the second
+		// parent are removed first, then the other ones, the smallest first
+		solution apply(const solution& a,
+		               const solution& b,
+		               [[maybe_unused]] random_engine& generator) const noexcept
+		{
+			solution solution(problem);
+			solution.selected_subsets = a.selected_subsets;
+			solution.selected_subsets |= b.selected_subsets;
+
+			// same order as the removal
+			std::vector<std::pair<size_t, size_t>> subsets_order; // (order, subset)
+			solution.selected_subsets.iterate_bits_on([&](size_t i_subset) noexcept {
+				const size_t subset_size = problem.subsets_points[i_subset].count();
+				subsets_order.emplace_back(
+				  a.selected_subsets[i_subset] ? problem.points_number + subset_size : subset_size,
+				  i_subset);
+			});
+			std::sort(subsets_order.begin(), subsets_order.end());
+			std::vector<size_t> subsets;
+			subsets.reserve(subsets_order.size());
+			for(const auto& [order, i_subset]: subsets_order)
+			{
+				subsets.push_back(i_subset);
+			}
+
+			solution.covered_points.set();
+			solution.cover_all_points = true;
+			solution.compute_hash();
+			uscp::redundancy::remove_ordered(solution, subsets);
+			return solution;
+		}
+
+		solution apply1(const solution& a, const solution& b, random_engine& generator) const
+		  noexcept
+		{
+			return apply(a, b, generator);
+		}
+
+		solution apply2(const solution& a, const solution& b, random_engine& generator) const
+		  noexcept
+		{
+			return apply(b, a, generator);
+		}
+
+		[[nodiscard]] static std::string_view to_string() noexcept
+		{
+			return "pruned_merge";
+		}
+
+		const uscp::problem::instance& problem;
+	};
+} // namespace uscp::crossover
+
+#endif //USCP_PRUNED_MERGE_HPP
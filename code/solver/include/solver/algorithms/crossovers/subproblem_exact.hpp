@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_SUBPROBLEM_EXACT_HPP
+#define USCP_SUBPROBLEM_EXACT_HPP
+
+#include "common/data/instance.hpp"
+#include "common/data/solution.hpp"
+#include "common/utils/random.hpp"
+#include "common/utils/logger.hpp"
+#include "solver/data/solution.hpp"
+#include "solver/algorithms/greedy.hpp"
+#include "solver/algorithms/rwls.hpp"
+#include "solver/algorithms/branch_and_bound.hpp"
+#include "solver/algorithms/subproblem.hpp"
+
+#include <dynamic_bitset.hpp>
+
+#include <string_view>
+#include <cstddef>
+#include <utility>
+
+namespace uscp::crossover
+{
+	struct subproblem_exact final
+	{
+		struct config final
+		{
+			// larger reduced subproblems are only improved by RWLS, default to the largest
+			// fixed-width bitsets of the branch and bound
+			size_t max_subsets = 256;
+			size_t max_nodes = 100000;
+			double max_time = 1; // seconds
+		};
+
+		explicit subproblem_exact(const uscp::problem::instance& problem_)
+		  : subproblem_exact(problem_, config())
+		{
+		}
+		subproblem_exact(const uscp::problem::instance& problem_, const config& config_)
+		  : problem(problem_), points_subsets(problem_), max_subsets(config_.max_subsets)
+		{
+			stopping_criterion.steps = problem.subsets_number + problem.points_number;
+			search_limits.max_nodes = config_.max_nodes;
+			search_limits.max_time = config_.max_time;
+		}
+		subproblem_exact(const subproblem_exact&) = default;
+		subproblem_exact(subproblem_exact&&) noexcept = default;
+		subproblem_exact& operator=(const subproblem_exact& other) = delete;
+		subproblem_exact& operator=(subproblem_exact&& other) noexcept = delete;
+
+		// optimal solution of the reduced subproblem if it is small, RWLS from the best solution
+		// found if the branch and bound reached its limits or from the greedy one if it is large
+		solution apply(const dynamic_bitset<>& authorized_subsets,
+		               bool reverse_greedy,
+		               random_engine& generator) noexcept
+		{
+			const uscp::problem::instance subproblem = points_subsets.reduce(authorized_subsets);
+			if(subproblem.subsets_number == 0)
+			{
+				// solved by the reductions
+				return expand(solution(subproblem));
+			}
+			solution subproblem_solution = reverse_greedy
+			                                 ? uscp::greedy::rsolve(subproblem, NULL_LOGGER)
+			                                 : uscp::greedy::solve(subproblem, NULL_LOGGER);
+			assert(subproblem_solution.cover_all_points);
+
+			if(subproblem.subsets_number <= max_subsets)
+			{
+				uscp::branch_and_bound::report report =
+				  uscp::branch_and_bound::solve(subproblem_solution, search_limits, NULL_LOGGER);
+				if(report.optimal)
+				{
+					return expand(report.solution_final);
+				}
+				subproblem_solution = std::move(report.solution_final);
+			}
+			uscp::rwls::rwls rwls(subproblem, NULL_LOGGER);
+			rwls.initialize();
+			return expand(
+			  rwls.improve(subproblem_solution, generator, stopping_criterion).solution_final);
+		}
+
+		solution apply1(const solution& a, const solution& b, random_engine& generator) noexcept
+		{
+			dynamic_bitset<> authorized_subsets = a.selected_subsets;
+			authorized_subsets |= b.selected_subsets;
+			return apply(authorized_subsets, false, generator);
+		}
+
+		solution apply2(const solution& a, const solution& b, random_engine& generator) noexcept
+		{
+			dynamic_bitset<> authorized_subsets = a.selected_subsets;
+			authorized_subsets |= b.selected_subsets;
+			return apply(authorized_subsets, true, generator);
+		}
+
+		[[nodiscard]] static std::string_view to_string() noexcept
+		{
+			return "subproblem_exact";
+		}
+
+		const uscp::problem::instance& problem;
+		uscp::subproblem::points_subsets points_subsets;
+		size_t max_subsets;
+		uscp::rwls::position stopping_criterion;
+		uscp::branch_and_bound::config search_limits;
+	};
+} // namespace uscp::crossover
+
+#endif //USCP_SUBPROBLEM_EXACT_HPP
@@ -12,8 +12,10 @@
 #include "common/data/solution.hpp"
 #include "common/utils/random.hpp"
 #include "common/utils/logger.hpp"
+#include "solver/data/solution.hpp"
 #include "solver/algorithms/greedy.hpp"
 #include "solver/algorithms/rwls.hpp"
+#include "solver/algorithms/subproblem.hpp"
 
 #include <dynamic_bitset.hpp>
 
@@ -24,76 +26,49 @@ namespace uscp::crossover
 	struct subproblem_rwls final
 	{
 		explicit subproblem_rwls(const uscp::problem::instance& problem_)
-		  : problem(problem_), rwls(problem_, NULL_LOGGER)
+		  : problem(problem_), points_subsets(problem_)
 		{
-			rwls.initialize();
 			stopping_criterion.steps = problem.subsets_number + problem.points_number;
-			subsets_covering_points.resize(problem.points_number);
-			for(size_t i = 0; i < problem.points_number; ++i)
-			{
-				subsets_covering_points[i].resize(problem.subsets_number);
-			}
-			for(size_t i = 0; i < problem.subsets_number; ++i)
-			{
-				problem.subsets_points[i].iterate_bits_on([&](size_t bit_on) noexcept {
-					assert(bit_on < subsets_covering_points.size());
-					assert(i < subsets_covering_points[bit_on].size());
-					subsets_covering_points[bit_on].set(i);
-				});
-			}
 		}
 		subproblem_rwls(const subproblem_rwls&) = default;
 		subproblem_rwls(subproblem_rwls&&) noexcept = default;
 		subproblem_rwls& operator=(const subproblem_rwls& other) = delete;
 		subproblem_rwls& operator=(subproblem_rwls&& other) noexcept = delete;
 
-		solution apply(solution solution,
-		               dynamic_bitset<> authorized_subsets,
-		               random_engine& generator)
+		// RWLS on the subproblem reduced by domination and inclusion, from a greedy solution
+		solution apply(const dynamic_bitset<>& authorized_subsets,
+		               bool reverse_greedy,
+		               random_engine& generator) noexcept
 		{
-			// inclusion reduction for RWLS
-			dynamic_bitset<> tmp(problem.subsets_number);
-			dynamic_bitset<> included_subsets(problem.subsets_number);
-			for(size_t i = 0; i < problem.points_number; ++i)
+			const uscp::problem::instance subproblem = points_subsets.reduce(authorized_subsets);
+			if(subproblem.subsets_number == 0)
 			{
-				tmp = subsets_covering_points[i];
-				tmp &= authorized_subsets;
-				assert(tmp.count() > 0);
-				if(tmp.count() == 1)
-				{
-					const size_t only_authorized_subset_covering = tmp.find_first();
-					included_subsets.set(only_authorized_subset_covering);
-				}
+				// solved by the reductions
+				return expand(solution(subproblem));
 			}
-			authorized_subsets -= included_subsets;
-			solution.selected_subsets |= included_subsets;
+			const solution subproblem_solution = reverse_greedy
+			                                       ? uscp::greedy::rsolve(subproblem, NULL_LOGGER)
+			                                       : uscp::greedy::solve(subproblem, NULL_LOGGER);
+			assert(subproblem_solution.cover_all_points);
 
-			uscp::rwls::report report =
-			  rwls.restricted_improve(solution, generator, stopping_criterion, authorized_subsets);
-
-			return report.solution_final;
+			uscp::rwls::rwls rwls(subproblem, NULL_LOGGER);
+			rwls.initialize();
+			return expand(
+			  rwls.improve(subproblem_solution, generator, stopping_criterion).solution_final);
 		}
 
 		solution apply1(const solution& a, const solution& b, random_engine& generator) noexcept
 		{
 			dynamic_bitset<> authorized_subsets = a.selected_subsets;
 			authorized_subsets |= b.selected_subsets;
-			solution solution =
-			  uscp::greedy::restricted_solve(problem, authorized_subsets, NULL_LOGGER);
-			assert(solution.cover_all_points);
-
-			return apply(std::move(solution), std::move(authorized_subsets), generator);
+			return apply(authorized_subsets, false, generator);
 		}
 
 		solution apply2(const solution& a, const solution& b, random_engine& generator) noexcept
 		{
 			dynamic_bitset<> authorized_subsets = a.selected_subsets;
 			authorized_subsets |= b.selected_subsets;
-			solution solution =
-			  uscp::greedy::restricted_rsolve(problem, authorized_subsets, NULL_LOGGER);
-			assert(solution.cover_all_points);
-
-			return apply(std::move(solution), std::move(authorized_subsets), generator);
+			return apply(authorized_subsets, true, generator);
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
@@ -102,8 +77,7 @@ namespace uscp::crossover
 		}
 
 		const uscp::problem::instance& problem;
-		std::vector<dynamic_bitset<>> subsets_covering_points;
-		uscp::rwls::rwls rwls;
+		uscp::subproblem::points_subsets points_subsets;
 		uscp::rwls::position stopping_criterion;
 	};
 } // namespace uscp::crossover
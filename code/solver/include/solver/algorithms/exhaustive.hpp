@@ -13,8 +13,10 @@
 
 namespace uscp::exhaustive
 {
+	// enumerate the solutions by increasing number of subsets
 	[[nodiscard]] solution solve(const problem::instance& problem);
 
+	// branch and bound from a RWLS solution, bounded by the Lagrangian relaxation
 	[[nodiscard]] solution solve_ram(const problem::instance& problem);
 } // namespace uscp::exhaustive
 
@@ -0,0 +1,55 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_GRASP_HPP
+#define USCP_GRASP_HPP
+
+#include "common/data/instance.hpp"
+#include "common/data/solution.hpp"
+#include "common/utils/random.hpp"
+#include "common/utils/logger.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace uscp::grasp
+{
+	struct config final
+	{
+		// restricted candidate list: subsets with gain >= max - alpha * (max - min)
+		// alpha = 0 is the random greedy (uniform choice between the maximum gains)
+		double alpha = 0;
+
+		// if not 0, restricted candidate list of the candidates_number best subsets
+		size_t candidates_number = 0;
+
+		// OpenMP threads of the batches, 0 for the hardware ones
+		size_t threads = 0;
+	};
+
+	[[nodiscard, gnu::hot]] solution solve(random_engine& generator,
+	                                       const problem::instance& problem,
+	                                       const config& config = {},
+	                                       std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
+
+	// solutions built in parallel, each one with its own generator split from generator
+	[[nodiscard, gnu::hot]] std::vector<solution> solve_batch(
+	  random_engine& generator,
+	  const problem::instance& problem,
+	  size_t solutions_number,
+	  const config& config = {},
+	  std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
+
+	[[nodiscard, gnu::hot]] solution solve_best(
+	  random_engine& generator,
+	  const problem::instance& problem,
+	  size_t solutions_number,
+	  const config& config = {},
+	  std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
+} // namespace uscp::grasp
+
+#endif //USCP_GRASP_HPP
@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_LAGRANGIAN_HPP
+#define USCP_LAGRANGIAN_HPP
+
+#include "common/data/instance.hpp"
+#include "common/utils/logger.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace uscp::lagrangian
+{
+	// subgradient optimization of the Lagrangian relaxation of the covering constraints
+	struct config final
+	{
+		size_t iterations = 1000;
+		double step_factor = 2;          // initial step factor
+		size_t step_halving_period = 30; // iterations without improvement to halve the step
+		double step_factor_min = 0.005;  // stop when the step factor is lower
+	};
+
+	struct report final
+	{
+		double lagrangian_bound = 0;
+		size_t lower_bound = 0; // minimum subsets number of any solution
+		size_t upper_bound = 0; // subsets number of the greedy solution used by the steps
+		size_t iterations = 0;
+		double time = 0;
+		std::vector<double> multipliers; // of the best bound, used to price the subsets
+	};
+
+	[[nodiscard, gnu::hot]] report lower_bound(
+	  const problem::instance& problem,
+	  const config& config = {},
+	  std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
+
+	// warm start from the multipliers of a previous computation
+	[[nodiscard, gnu::hot]] report lower_bound(
+	  const problem::instance& problem,
+	  std::vector<double> multipliers,
+	  const config& config = {},
+	  std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
+
+	// reduced costs of the subsets: 1 - sum(u_i, i in S_j)
+	[[nodiscard]] std::vector<double> reduced_costs(
+	  const std::vector<std::vector<size_t>>& subsets_points,
+	  const std::vector<double>& multipliers) noexcept;
+} // namespace uscp::lagrangian
+
+#endif //USCP_LAGRANGIAN_HPP
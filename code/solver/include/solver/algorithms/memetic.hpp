@@ -13,10 +13,17 @@
 #include "common/utils/random.hpp"
 #include "common/algorithms//memetic.hpp"
 #include "solver/algorithms/rwls.hpp"
+#include "solver/algorithms/adaptive.hpp"
+#include "solver/algorithms/subproblem.hpp"
 
 #include <cstddef>
 #include <limits>
 #include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cstdint>
 
 namespace uscp::memetic
 {
@@ -34,11 +41,55 @@ namespace uscp::memetic
 	{
 		position stopping_criterion;
 		uscp::rwls::position rwls_stopping_criterion;
+		size_t population_size = 2;
+		size_t islands_number = 1;
+		size_t migration_interval = 10; // generations between islands migrations, 0 to disable
+		bool steady_state = false;      // asynchronous workers instead of generations
+		size_t lower_bound = 0;         // stop when a solution of this size is found, 0 if unknown
+
+		// operator of an adaptive pool always selected, empty to select between all of them
+		// not serialized: saved as the report operator
+		std::string crossover;
+		std::string wcrossover;
+
+		// not serialized: no influence on the results
+		std::string checkpoint_path;    // empty to disable checkpoints
+		double checkpoint_period = 600; // seconds between checkpoints
+		size_t threads = 0;             // threads of the population loops or workers, 0 for all
+		// state of the caller saved in the checkpoints, to skip its finished runs on resume
+		std::string checkpoint_progress;
 
 		[[nodiscard]] config_serial serialize() const noexcept;
 		bool load(const config_serial& serial) noexcept;
 	};
 
+	// offspring improvements of a crossover or weights crossover operator
+	struct operator_statistics final
+	{
+		std::string name;
+		adaptive::arm_statistics statistics;
+
+		[[nodiscard]] operator_statistics_serial serialize() const noexcept;
+		bool load(const operator_statistics_serial& serial) noexcept;
+	};
+
+	// time spent in each phase of the algorithm, in seconds
+	struct phases_time final
+	{
+		double rwls = 0;
+		double crossover = 0; // including the RWLS of the subproblem crossovers
+		double wcrossover = 0;
+		double restarts = 0; // random solutions replacing explored, stalled or duplicated ones
+		double logging = 0;
+		double other = 0;
+
+		[[nodiscard]] double total() const noexcept;
+		phases_time& operator+=(const phases_time& phases) noexcept;
+
+		[[nodiscard]] phases_time_serial serialize() const noexcept;
+		bool load(const phases_time_serial& serial) noexcept;
+	};
+
 	struct report final
 	{
 		solution solution_final;
@@ -48,6 +99,13 @@ namespace uscp::memetic
 		config solve_config;
 		std::string crossover_operator;
 		std::string wcrossover_operator;
+		size_t found_by_island;
+		std::vector<operator_statistics> crossovers_statistics;
+		std::vector<operator_statistics> wcrossovers_statistics;
+		// wall time of the run, cumulated over the islands or the steady-state workers
+		phases_time phases;
+		// wall time of each generation, of the island of the report, none in steady-state mode
+		std::vector<phases_time> generations_phases;
 
 		explicit report(const problem::instance& problem) noexcept;
 		report(const report&) = default;
@@ -59,6 +117,102 @@ namespace uscp::memetic
 		bool load(const report_serial& serial) noexcept;
 	};
 
+	// best solution of an island, sent to its neighbour
+	struct migrant final
+	{
+		solution solution_best;
+		std::vector<long long> points_weights;
+	};
+
+	// one slot per island, written by its island and read by its neighbour without lock
+	class mailboxes final
+	{
+	public:
+		explicit mailboxes(size_t islands_number) noexcept;
+
+		void post(size_t island, std::shared_ptr<const migrant> migrant) noexcept;
+		[[nodiscard]] std::shared_ptr<const migrant> read(size_t island) const noexcept;
+		[[nodiscard]] size_t islands_number() const noexcept;
+
+		// set by the island reaching the lower bound, all the islands stop
+		void request_stop() noexcept;
+		[[nodiscard]] bool stop_requested() const noexcept;
+
+	private:
+		std::vector<std::shared_ptr<const migrant>> m_mailboxes;
+		std::atomic<bool> m_stop;
+	};
+
+	// hashes of the recently seen solutions, direct-mapped table without lock: a newer hash
+	// replaces an older one of the same slot, so only the recent solutions are remembered
+	class recent_solutions final
+	{
+	public:
+		explicit recent_solutions(size_t capacity) noexcept;
+		recent_solutions(const recent_solutions&) = delete;
+		recent_solutions(recent_solutions&&) noexcept = delete;
+		recent_solutions& operator=(const recent_solutions& other) = delete;
+		recent_solutions& operator=(recent_solutions&& other) noexcept = delete;
+
+		// return true if the solution was already seen
+		[[nodiscard, gnu::hot]] bool insert(const solution& solution) noexcept;
+
+		// content saved in checkpoints, not to be used concurrently with insert
+		[[nodiscard]] std::vector<uint64_t> hashes() const noexcept;
+		bool load(const std::vector<uint64_t>& hashes) noexcept;
+
+	private:
+		std::vector<std::atomic<uint64_t>> m_hashes;
+		uint64_t m_mask;
+	};
+
+	// state of a single population run at the start of a generation, to resume it
+	// solutions are stored as selected subsets numbers, the problem is checked on resume
+	struct checkpoint final
+	{
+		std::string problem_name;
+		size_t points_number = 0;
+		size_t subsets_number = 0;
+		std::string crossover_operator;
+		std::string wcrossover_operator;
+		std::string progress; // state of the caller, to skip its finished runs on resume
+
+		random_engine generator;
+		std::vector<random_engine> individuals_generators;
+		size_t generation = 0;
+		uscp::rwls::position rwls_cumulative_position;
+		double time = 0;
+		size_t rwls_steps = 0;
+		std::vector<size_t> dynamic_steps;
+		std::vector<size_t> parents_order;
+		std::vector<std::vector<size_t>> population;
+		std::vector<std::vector<long long>> population_weights;
+		std::vector<uint64_t> explored;
+
+		std::vector<size_t> solution_best;
+		std::vector<long long> points_weights_best;
+		position found_at;
+
+		// operators selection, offspring of the previous generation not yet rewarded
+		std::vector<adaptive::arm_statistics> crossovers_statistics;
+		std::vector<adaptive::arm_statistics> wcrossovers_statistics;
+		size_t crossover_selected = 0;
+		size_t wcrossover_selected = 0;
+		std::vector<size_t> offspring_parents_best;
+		std::vector<double> offspring_time;
+
+		phases_time phases;
+		std::vector<phases_time> generations_phases;
+
+		[[nodiscard]] std::vector<char> serialize() const noexcept;
+		bool load(const std::vector<char>& data) noexcept;
+
+		// same problem and operators, with valid subsets and weights
+		[[nodiscard]] bool compatible(const problem::instance& problem,
+		                              std::string_view crossover,
+		                              std::string_view wcrossover) const noexcept;
+	};
+
 	template<typename Crossover, typename WeightsCrossover>
 	class memetic final
 	{
@@ -70,15 +224,39 @@ namespace uscp::memetic
 		memetic& operator=(memetic&& other) noexcept = delete;
 
 		[[gnu::hot]] void initialize() noexcept;
-		[[gnu::hot]] report solve(random_engine& generator, config config) noexcept;
+		// resume: continue a checkpointed run instead of starting a new one
+		[[gnu::hot]] report solve(random_engine& generator,
+		                          config config,
+		                          const checkpoint* resume = nullptr) noexcept;
 
 	private:
+		// hashes of the solutions already improved by RWLS
+		static constexpr size_t recent_solutions_capacity = 4096;
+
+		template<typename Operator>
+		[[nodiscard]] static std::vector<operator_statistics> statistics(
+		  const adaptive::ucb& bandit) noexcept;
+
+		// pinned: name of the operator of the adaptive pool always selected, empty for none
+		template<typename Operator>
+		static void pin(adaptive::ucb& bandit, const std::string& pinned) noexcept;
+		template<typename Operator>
+		[[nodiscard]] static std::string operator_used(const std::string& pinned) noexcept;
+
+		[[gnu::hot]] report solve_steady_state(random_engine& generator, config config) noexcept;
+		[[gnu::hot]] report solve_island(random_engine& generator,
+		                                 config config,
+		                                 mailboxes* islands_mailboxes,
+		                                 size_t island,
+		                                 const checkpoint* resume = nullptr) noexcept;
+
 		template<size_t v>
 		struct dependent_false : public std::false_type
 		{
 		};
 
 		const uscp::problem::instance& m_problem;
+		uscp::subproblem::points_subsets m_points_subsets; // random solutions of the restarts
 		Crossover m_crossover;
 		WeightsCrossover m_wcrossover;
 		uscp::rwls::rwls m_rwls;
@@ -16,13 +16,26 @@
 #include "common/utils/logger.hpp"
 #include "solver/algorithms/random.hpp"
 #include "greedy.hpp"
+#include "solver/algorithms/grasp.hpp"
+#include "solver/utils/async_file_writer.hpp"
 
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <deque>
 #include <array>
+#include <optional>
+#include <functional>
 
 template<typename Crossover, typename WeightsCrossover>
 uscp::memetic::memetic<Crossover, WeightsCrossover>::memetic(
   const problem::instance& problem) noexcept
   : m_problem(problem)
+  , m_points_subsets(problem)
   , m_crossover(problem)
   , m_wcrossover(problem)
   , m_rwls(problem, NULL_LOGGER)
@@ -39,6 +52,174 @@ void uscp::memetic::memetic<Crossover, WeightsCrossover>::initialize() noexcept
 
 template<typename Crossover, typename WeightsCrossover>
 uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve(
+  uscp::random_engine& generator,
+  uscp::memetic::config config,
+  const checkpoint* resume) noexcept
+{
+	// initialized before the islands share the RWLS data
+	if(!m_initialized)
+	{
+		initialize();
+	}
+
+	m_rwls.set_lower_bound(config.lower_bound);
+
+	if((config.steady_state || config.islands_number > 1)
+	   && (resume != nullptr || !config.checkpoint_path.empty()))
+	{
+		LOGGER->warn("({}) Memetic checkpoints are only supported with a single population: ignored",
+		             m_problem.name);
+		resume = nullptr;
+		config.checkpoint_path.clear();
+	}
+
+	if(config.steady_state)
+	{
+		if(config.islands_number > 1)
+		{
+			LOGGER->warn("({}) Memetic islands are ignored in steady-state mode", m_problem.name);
+		}
+		return solve_steady_state(generator, config);
+	}
+
+	if(config.islands_number <= 1)
+	{
+		return solve_island(generator, config, nullptr, 0, resume);
+	}
+
+	LOGGER->info("({}) Start solving problem with {} memetic islands",
+	             m_problem.name,
+	             config.islands_number);
+	const timer timer;
+
+	// one stream per island: the islands generators don't depend on the threads scheduling
+	std::vector<random_engine> islands_generators = split(generator, config.islands_number);
+
+	// the hardware threads shared between the islands
+	config.threads = std::max<size_t>(
+	  1, std::max(std::thread::hardware_concurrency(), 1u) / config.islands_number);
+
+	mailboxes islands_mailboxes(config.islands_number);
+	std::vector<report> islands_reports(config.islands_number, report(m_problem));
+	std::vector<std::thread> islands;
+	islands.reserve(config.islands_number);
+	for(size_t island = 0; island < config.islands_number; ++island)
+	{
+		islands.emplace_back([&, island]() noexcept {
+			islands_reports[island] =
+			  solve_island(islands_generators[island], config, &islands_mailboxes, island);
+		});
+	}
+	for(std::thread& island: islands)
+	{
+		island.join();
+	}
+
+	const size_t best_island = static_cast<size_t>(std::distance(
+	  islands_reports.cbegin(),
+	  std::min_element(islands_reports.cbegin(),
+	                   islands_reports.cend(),
+	                   [](const report& a, const report& b) noexcept {
+		                   const size_t a_subsets_number = a.solution_final.selected_subsets.count();
+		                   const size_t b_subsets_number = b.solution_final.selected_subsets.count();
+		                   if(a_subsets_number != b_subsets_number)
+		                   {
+			                   return a_subsets_number < b_subsets_number;
+		                   }
+		                   return a.found_at.time < b.found_at.time;
+	                   })));
+	report report = islands_reports[best_island];
+	report.found_by_island = best_island;
+
+	// cumulated over the islands
+	report.ended_at.generation = 0;
+	report.ended_at.rwls_cumulative_position.steps = 0;
+	report.ended_at.rwls_cumulative_position.time = 0;
+	auto cumulate_statistics = [](std::vector<operator_statistics>& total,
+	                              const std::vector<operator_statistics>& island) noexcept {
+		assert(total.size() == island.size());
+		for(size_t i = 0; i < total.size(); ++i)
+		{
+			total[i].statistics.uses += island[i].statistics.uses;
+			total[i].statistics.improvement += island[i].statistics.improvement;
+			total[i].statistics.time += island[i].statistics.time;
+		}
+	};
+	for(operator_statistics& statistics: report.crossovers_statistics)
+	{
+		statistics.statistics = {};
+	}
+	for(operator_statistics& statistics: report.wcrossovers_statistics)
+	{
+		statistics.statistics = {};
+	}
+	report.phases = {};
+	for(const uscp::memetic::report& island_report: islands_reports)
+	{
+		report.ended_at.generation += island_report.ended_at.generation;
+		report.ended_at.rwls_cumulative_position += island_report.ended_at.rwls_cumulative_position;
+		cumulate_statistics(report.crossovers_statistics, island_report.crossovers_statistics);
+		cumulate_statistics(report.wcrossovers_statistics, island_report.wcrossovers_statistics);
+		report.phases += island_report.phases;
+	}
+	report.ended_at.time = timer.elapsed();
+
+	LOGGER->info("({}) Memetic islands found solution with {} subsets on island {} in {}s",
+	             m_problem.name,
+	             report.solution_final.selected_subsets.count(),
+	             best_island,
+	             timer.elapsed());
+
+	return report;
+}
+
+template<typename Crossover, typename WeightsCrossover>
+template<typename Operator>
+std::vector<uscp::memetic::operator_statistics> uscp::memetic::memetic<Crossover, WeightsCrossover>::
+  statistics(const adaptive::ucb& bandit) noexcept
+{
+	std::vector<operator_statistics> statistics;
+	statistics.reserve(bandit.statistics().size());
+	for(size_t i_operator = 0; i_operator < bandit.statistics().size(); ++i_operator)
+	{
+		statistics.push_back(
+		  operator_statistics{std::string(adaptive::operator_name<Operator>(i_operator)),
+		                      bandit.statistics()[i_operator]});
+	}
+	return statistics;
+}
+
+template<typename Crossover, typename WeightsCrossover>
+template<typename Operator>
+void uscp::memetic::memetic<Crossover, WeightsCrossover>::pin(adaptive::ucb& bandit,
+                                                              const std::string& pinned) noexcept
+{
+	if(pinned.empty())
+	{
+		return;
+	}
+	for(size_t i_operator = 0; i_operator < adaptive::operators_number<Operator>(); ++i_operator)
+	{
+		if(adaptive::operator_name<Operator>(i_operator) == pinned)
+		{
+			bandit.pin(i_operator);
+			return;
+		}
+	}
+	LOGGER->error("No operator named \"{}\" in {}", pinned, Operator::to_string());
+	abort();
+}
+
+template<typename Crossover, typename WeightsCrossover>
+template<typename Operator>
+std::string uscp::memetic::memetic<Crossover, WeightsCrossover>::operator_used(
+  const std::string& pinned) noexcept
+{
+	return pinned.empty() ? std::string(Operator::to_string()) : pinned;
+}
+
+template<typename Crossover, typename WeightsCrossover>
+uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve_steady_state(
   uscp::random_engine& generator,
   uscp::memetic::config config) noexcept
 {
@@ -47,64 +228,388 @@ uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve
 	config.rwls_stopping_criterion.steps = std::numeric_limits<size_t>::max();
 	config.rwls_stopping_criterion.time = std::numeric_limits<double>::max();
 
-	if(!m_initialized)
+	const size_t workers_number =
+	  config.threads > 0 ? config.threads : std::max(std::thread::hardware_concurrency(), 1u);
+	LOGGER->info("({}) Start solving problem with steady-state memetic algorithm ({}/{}) on {} threads",
+	             m_problem.name,
+	             operator_used<Crossover>(config.crossover),
+	             operator_used<WeightsCrossover>(config.wcrossover),
+	             workers_number);
+
+	report report(m_problem);
+	report.solve_config = config;
+	report.crossover_operator = operator_used<Crossover>(config.crossover);
+	report.wcrossover_operator = operator_used<WeightsCrossover>(config.wcrossover);
+
+	const timer timer;
+
+	struct individual final
 	{
-		initialize();
+		solution individual_solution;
+		std::vector<long long> points_weights;
+
+		// offspring: operators rewarded by the improvement of the parents after RWLS
+		bool from_crossover = false;
+		size_t crossover_operator = 0;
+		size_t wcrossover_operator = 0;
+		size_t parents_best = 0; // 0 if no improvement can be credited to the operators
+		double crossover_time = 0;
+	};
+
+	// shared data, protected by mutex
+	// generation is the number of offspring improved by RWLS
+	std::mutex mutex;
+	std::deque<individual> offspring;
+	std::vector<individual> population;
+	size_t generation = 0;
+	uscp::rwls::position rwls_cumulative_position;
+	rwls_cumulative_position.steps = 0;
+	rwls_cumulative_position.time = 0;
+	size_t best_solution_subsets_number = std::numeric_limits<size_t>::max();
+	static constexpr size_t dynamic_steps_recorded_offspring = 20;
+	const size_t base_steps = m_problem.subsets_number + m_problem.points_number;
+	std::deque<size_t> dynamic_steps(dynamic_steps_recorded_offspring, base_steps);
+	size_t stalled_steps_factor = 1; // doubled each time RWLS does not improve an offspring
+	recent_solutions explored(recent_solutions_capacity); // lock free, used outside of mutex
+	adaptive::ucb crossover_bandit(adaptive::operators_number<Crossover>());
+	adaptive::ucb wcrossover_bandit(adaptive::operators_number<WeightsCrossover>());
+	pin<Crossover>(crossover_bandit, config.crossover);
+	pin<WeightsCrossover>(wcrossover_bandit, config.wcrossover);
+
+	// Population: the initial solutions are the first offspring
+	const size_t population_size = std::max(config.population_size, size_t(2));
+	population.reserve(population_size);
+	for(solution& initial_solution:
+	    uscp::grasp::solve_batch(generator, m_problem, population_size, {}, NULL_LOGGER))
+	{
+		offspring.push_back(individual{std::move(initial_solution),
+		                               std::vector<long long>(m_problem.points_number, 1)});
+	}
+	SPDLOG_LOGGER_DEBUG(
+	  LOGGER, "({}) Memetic population initialized in {}s", m_problem.name, timer.elapsed());
+
+	auto worker = [&](random_engine& worker_generator) noexcept {
+		uscp::rwls::position rwls_stopping_criterion = config.rwls_stopping_criterion;
+		std::optional<individual> restart;
+
+		// time since the last lap attributed to a phase
+		phases_time worker_phases;
+		::timer phase_timer;
+		auto lap = [&phase_timer](double& phase) noexcept {
+			phase += phase_timer.elapsed();
+			phase_timer.reset();
+		};
+		while(true)
+		{
+			// take an offspring, or two parents to build offspring as soon as there is no more
+			std::optional<individual> current = std::move(restart);
+			restart.reset();
+			std::optional<std::array<individual, 2>> parents;
+			size_t crossover_operator = 0;
+			size_t wcrossover_operator = 0;
+			{
+				const std::lock_guard<std::mutex> lock(mutex);
+				if(!(rwls_cumulative_position < config.stopping_criterion.rwls_cumulative_position)
+				   || !(timer.elapsed() < config.stopping_criterion.time)
+				   || best_solution_subsets_number <= config.lower_bound)
+				{
+					lap(worker_phases.other);
+					report.phases += worker_phases;
+					return;
+				}
+				// found at steps of a pair of parents, as in generational mode
+				rwls_stopping_criterion.steps =
+				  stalled_steps_factor
+				  * (base_steps
+				     + std::accumulate(
+				         std::begin(dynamic_steps), std::end(dynamic_steps), size_t(0))
+				         / dynamic_steps.size());
+				if(current)
+				{
+					// restart from a random solution
+				}
+				else if(!offspring.empty())
+				{
+					current = std::move(offspring.front());
+					offspring.pop_front();
+				}
+				else if(population.size() >= 2)
+				{
+					const size_t a = uscp::random_index(worker_generator, population.size());
+					size_t b = uscp::random_index(worker_generator, population.size() - 1);
+					if(b >= a)
+					{
+						++b;
+					}
+					parents = {population[a], population[b]};
+					crossover_operator = crossover_bandit.select();
+					wcrossover_operator = wcrossover_bandit.select();
+				}
+			}
+
+			if(parents)
+			{
+				const individual& a = (*parents)[0];
+				const individual& b = (*parents)[1];
+				const size_t parents_best = std::min(a.individual_solution.selected_subsets.count(),
+				                                     b.individual_solution.selected_subsets.count());
+				lap(worker_phases.other);
+				::timer crossover_timer;
+				solution second_solution = adaptive::apply2(m_crossover,
+				                                            crossover_operator,
+				                                            a.individual_solution,
+				                                            b.individual_solution,
+				                                            worker_generator);
+				lap(worker_phases.crossover);
+				std::vector<long long> second_weights = adaptive::apply2(
+				  m_wcrossover, wcrossover_operator, a.points_weights, b.points_weights, worker_generator);
+				lap(worker_phases.wcrossover);
+				individual second{std::move(second_solution),
+				                  std::move(second_weights),
+				                  true,
+				                  crossover_operator,
+				                  wcrossover_operator,
+				                  parents_best,
+				                  crossover_timer.elapsed()};
+				{
+					const std::lock_guard<std::mutex> lock(mutex);
+					offspring.push_back(std::move(second));
+				}
+				lap(worker_phases.other);
+				crossover_timer.reset();
+				solution first_solution = adaptive::apply1(m_crossover,
+				                                           crossover_operator,
+				                                           a.individual_solution,
+				                                           b.individual_solution,
+				                                           worker_generator);
+				lap(worker_phases.crossover);
+				std::vector<long long> first_weights = adaptive::apply1(
+				  m_wcrossover, wcrossover_operator, a.points_weights, b.points_weights, worker_generator);
+				lap(worker_phases.wcrossover);
+				current = individual{std::move(first_solution),
+				                     std::move(first_weights),
+				                     true,
+				                     crossover_operator,
+				                     wcrossover_operator,
+				                     parents_best,
+				                     crossover_timer.elapsed()};
+			}
+			else if(!current)
+			{
+				// less than two parents available yet: new random greedy individual
+				lap(worker_phases.other);
+				current = individual{
+				  uscp::greedy::random_solve(worker_generator, m_problem, NULL_LOGGER),
+				  std::vector<long long>(m_problem.points_number, 1)};
+				lap(worker_phases.restarts);
+			}
+
+			// no RWLS budget spent twice on the same solution: restart instead
+			lap(worker_phases.other);
+			if(explored.insert(current->individual_solution))
+			{
+				current->individual_solution = uscp::random::point_solve(
+				  worker_generator, m_problem, m_points_subsets, true, NULL_LOGGER);
+				current->parents_best = 0;
+			}
+			lap(worker_phases.restarts);
+
+			uscp::rwls::report rwls_report = m_rwls.improve(current->individual_solution,
+			                                                current->points_weights,
+			                                                worker_generator,
+			                                                rwls_stopping_criterion);
+			const size_t solution_subsets_number =
+			  rwls_report.solution_final.selected_subsets.count();
+			lap(worker_phases.rwls);
+
+			std::unique_lock<std::mutex> lock(mutex);
+			if(current->from_crossover)
+			{
+				const size_t improvement = current->parents_best > solution_subsets_number
+				                             ? current->parents_best - solution_subsets_number
+				                             : 0;
+				const double time = current->crossover_time + rwls_report.ended_at.time;
+				crossover_bandit.update(current->crossover_operator, improvement, time);
+				wcrossover_bandit.update(current->wcrossover_operator, improvement, time);
+			}
+			if(solution_subsets_number < best_solution_subsets_number)
+			{
+				rwls_report.solution_final.compute_cover();
+				assert(rwls_report.solution_final.cover_all_points);
+				if(!rwls_report.solution_final.cover_all_points)
+				{
+					LOGGER->error("Memetic new best solution doesn't cover all points");
+					abort();
+				}
+
+				report.solution_final = rwls_report.solution_final;
+				report.found_at.generation = generation;
+				report.found_at.rwls_cumulative_position =
+				  rwls_cumulative_position + rwls_report.found_at;
+				report.found_at.time = timer.elapsed();
+				report.points_weights_final = rwls_report.points_weights_final;
+				best_solution_subsets_number = solution_subsets_number;
+				lap(worker_phases.other);
+				LOGGER->info("({}) Memetic new best solution with {} subsets at offspring {} in {}s",
+				             m_problem.name,
+				             solution_subsets_number,
+				             generation,
+				             timer.elapsed());
+				lap(worker_phases.logging);
+			}
+			++generation;
+			rwls_cumulative_position += rwls_report.ended_at;
+			if(rwls_report.found_at.steps > 0)
+			{
+				dynamic_steps.push_back(2 * rwls_report.found_at.steps);
+				dynamic_steps.pop_front();
+				stalled_steps_factor = 1;
+			}
+			else if(stalled_steps_factor < (size_t(1) << 20))
+			{
+				stalled_steps_factor *= 2;
+			}
+
+			// replace the worst individual, the population is kept without duplicates
+			// as in generational mode, a stalled or duplicated offspring is replaced by a random
+			// solution keeping its RWLS weights
+			if(rwls_report.found_at.steps == 0
+			   || std::any_of(population.cbegin(),
+			                  population.cend(),
+			                  [&](const individual& other) noexcept {
+				                  return other.individual_solution.same_subsets(
+				                    rwls_report.solution_final);
+			                  }))
+			{
+				lock.unlock();
+				lap(worker_phases.other);
+				restart = individual{
+				  uscp::random::point_solve(
+				    worker_generator, m_problem, m_points_subsets, true, NULL_LOGGER),
+				  std::move(rwls_report.points_weights_final)};
+				lap(worker_phases.restarts);
+				continue;
+			}
+			individual improved{std::move(rwls_report.solution_final),
+			                    std::move(rwls_report.points_weights_final)};
+			if(population.size() < population_size)
+			{
+				population.push_back(std::move(improved));
+				continue;
+			}
+			individual& worst = *std::max_element(
+			  population.begin(),
+			  population.end(),
+			  [](const individual& a, const individual& b) noexcept {
+				  return a.individual_solution.selected_subsets.count()
+				         < b.individual_solution.selected_subsets.count();
+			  });
+			if(solution_subsets_number <= worst.individual_solution.selected_subsets.count())
+			{
+				worst = std::move(improved);
+			}
+		}
+	};
+
+	// one stream per worker: the workers generators don't depend on the threads scheduling
+	std::vector<random_engine> workers_generators = split(generator, workers_number);
+	std::vector<std::thread> workers;
+	workers.reserve(workers_number);
+	for(random_engine& worker_generator: workers_generators)
+	{
+		workers.emplace_back(worker, std::ref(worker_generator));
+	}
+	for(std::thread& worker_thread: workers)
+	{
+		worker_thread.join();
 	}
 
+	report.ended_at.generation = generation;
+	report.ended_at.rwls_cumulative_position = rwls_cumulative_position;
+	report.ended_at.time = timer.elapsed();
+	report.crossovers_statistics = statistics<Crossover>(crossover_bandit);
+	report.wcrossovers_statistics = statistics<WeightsCrossover>(wcrossover_bandit);
+
+	LOGGER->info("({}) Memetic found solution with {} subsets in {}s ({} offspring)",
+	             m_problem.name,
+	             report.solution_final.selected_subsets.count(),
+	             timer.elapsed(),
+	             generation);
+
+	return report;
+}
+
+template<typename Crossover, typename WeightsCrossover>
+uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve_island(
+  uscp::random_engine& generator,
+  uscp::memetic::config config,
+  mailboxes* islands_mailboxes,
+  size_t island,
+  const checkpoint* resume) noexcept
+{
+	// Memetic algorithm now uses dynamic RWLS steps, thus some parameters are now ignored
+	config.stopping_criterion.generation = std::numeric_limits<size_t>::max();
+	config.rwls_stopping_criterion.steps = std::numeric_limits<size_t>::max();
+	config.rwls_stopping_criterion.time = std::numeric_limits<double>::max();
+
 	LOGGER->info("({}) Start solving problem with memetic algorithm ({}/{})",
 	             m_problem.name,
-	             Crossover::to_string(),
-	             WeightsCrossover::to_string());
+	             operator_used<Crossover>(config.crossover),
+	             operator_used<WeightsCrossover>(config.wcrossover));
 
 	report report(m_problem);
 	report.solve_config = config;
-	report.crossover_operator = m_crossover.to_string();
-	report.wcrossover_operator = m_wcrossover.to_string();
+	report.crossover_operator = operator_used<Crossover>(config.crossover);
+	report.wcrossover_operator = operator_used<WeightsCrossover>(config.wcrossover);
 
 	timer timer;
+	const int threads_number = static_cast<int>(
+	  config.threads > 0 ? config.threads : std::max(std::thread::hardware_concurrency(), 1u));
 
 	// Population weights
-	std::array<std::vector<long long>, 2> population_weights;
-	for(std::vector<long long>& weights: population_weights)
-	{
-		weights.resize(m_problem.points_number, 1);
-	}
+	const size_t population_size =
+	  resume != nullptr ? resume->population.size() : std::max(config.population_size, size_t(2));
+	std::vector<std::vector<long long>> population_weights(
+	  population_size, std::vector<long long>(m_problem.points_number, 1));
 
 	// Population
-	std::array<solution, 2> population{solution(m_problem), solution(m_problem)};
-// OpenMP implementation changed in GCC9, see:
-// https://gcc.gnu.org/gcc-9/porting_to.html#ompdatasharing
-#if __GNUC__ < 9
-#	pragma omp parallel for default(none) shared(population, generator)
-#else
-#	pragma omp parallel for default(none) shared(population, generator, NULL_LOGGER)
-#endif
-	for(/*no size_t for openMP on Windows*/ int i_int = 0;
-	    i_int < static_cast<int>(population.size());
-	    ++i_int)
+	// random greedy solutions, built in parallel with independent generators
+	std::vector<solution> population;
+	if(resume == nullptr)
 	{
-		const size_t i = static_cast<size_t>(i_int);
-		population[i] = uscp::greedy::random_solve(generator, population[i].problem, NULL_LOGGER);
+		uscp::grasp::config population_config;
+		population_config.threads = config.threads;
+		population = uscp::grasp::solve_batch(
+		  generator, m_problem, population_size, population_config, NULL_LOGGER);
+		SPDLOG_LOGGER_DEBUG(
+		  LOGGER, "({}) Memetic population initialized in {}s", m_problem.name, timer.elapsed());
 	}
-	SPDLOG_LOGGER_DEBUG(
-	  LOGGER, "({}) Memetic population initialized in {}s", m_problem.name, timer.elapsed());
+	else
+	{
+		population.resize(population_size, solution(m_problem));
+	}
+
+	// one stream per individual, used by the parallel RWLS and crossovers
+	std::vector<random_engine> individuals_generators = split(generator, population_size);
 
 	size_t generation = 0;
 	uscp::rwls::position rwls_cumulative_position;
 	rwls_cumulative_position.steps = 0;
 	rwls_cumulative_position.time = 0;
 	size_t best_solution_subsets_number = std::numeric_limits<size_t>::max();
-	std::array<uscp::rwls::report, 2> rwls_reports{uscp::rwls::report(m_problem),
-	                                               uscp::rwls::report(m_problem)};
+	std::vector<uscp::rwls::report> rwls_reports(population_size, uscp::rwls::report(m_problem));
 
 	// Best initial solution
 	{
-		const std::array<size_t, 2> initial_population_subsets_number = {
-		  population[0].selected_subsets.count(), population[1].selected_subsets.count()};
-		const size_t initial_population_best =
-		  initial_population_subsets_number[0] < initial_population_subsets_number[1] ? 0 : 1;
-		best_solution_subsets_number = initial_population_subsets_number[initial_population_best];
+		const size_t initial_population_best = static_cast<size_t>(std::distance(
+		  population.cbegin(),
+		  std::min_element(population.cbegin(),
+		                   population.cend(),
+		                   [](const solution& a, const solution& b) noexcept {
+			                   return a.selected_subsets.count() < b.selected_subsets.count();
+		                   })));
+		best_solution_subsets_number =
+		  population[initial_population_best].selected_subsets.count();
 		report.solution_final = population[initial_population_best];
 		report.found_at.generation = 0;
 		report.found_at.rwls_cumulative_position.steps = 0;
@@ -120,25 +625,229 @@ uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve
 	dynamic_steps.resize(dynamic_steps_recorded_generations, base_steps);
 	config.rwls_stopping_criterion.steps = base_steps;
 
+	// Parents pairs: consecutive parents in a random order
+	std::vector<size_t> parents_order(population_size);
+	std::iota(parents_order.begin(), parents_order.end(), size_t(0));
+
+	recent_solutions explored(recent_solutions_capacity);
+
+	// Operators selection: rewarded with the improvement per second of their offspring
+	adaptive::ucb crossover_bandit(adaptive::operators_number<Crossover>());
+	adaptive::ucb wcrossover_bandit(adaptive::operators_number<WeightsCrossover>());
+	pin<Crossover>(crossover_bandit, config.crossover);
+	pin<WeightsCrossover>(wcrossover_bandit, config.wcrossover);
+	size_t crossover_selected = 0;
+	size_t wcrossover_selected = 0;
+	std::vector<size_t> offspring_parents_best(population_size, 0); // 0: no improvement credited
+	std::vector<double> offspring_time(population_size, 0);
+	std::vector<double> offspring_wcrossover_time(population_size, 0);
+	std::vector<size_t> parents_subsets_number(population_size, 0); // before randomizations
+
+	// Resume: state at the start of the checkpointed generation
+	auto load_subsets = [&](const std::vector<size_t>& subsets, solution& solution) noexcept {
+		solution.selected_subsets.reset();
+		for(size_t subset: subsets)
+		{
+			solution.selected_subsets.set(subset);
+		}
+		solution.compute_cover();
+	};
+	if(resume != nullptr)
+	{
+		assert(resume->compatible(m_problem,
+		                          operator_used<Crossover>(config.crossover),
+		                          operator_used<WeightsCrossover>(config.wcrossover)));
+		if(population_size != config.population_size)
+		{
+			LOGGER->warn("({}) Memetic resumed with the checkpoint population size {} instead of {}",
+			             m_problem.name,
+			             population_size,
+			             config.population_size);
+		}
+		generator = resume->generator;
+		individuals_generators = resume->individuals_generators;
+		generation = resume->generation;
+		rwls_cumulative_position = resume->rwls_cumulative_position;
+		timer.reset(resume->time);
+		config.rwls_stopping_criterion.steps = resume->rwls_steps;
+		dynamic_steps.assign(resume->dynamic_steps.cbegin(), resume->dynamic_steps.cend());
+		parents_order = resume->parents_order;
+		for(size_t i = 0; i < population_size; ++i)
+		{
+			load_subsets(resume->population[i], population[i]);
+		}
+		population_weights = resume->population_weights;
+		if(!explored.load(resume->explored))
+		{
+			LOGGER->warn("({}) Memetic resumed without the explored solutions", m_problem.name);
+		}
+		if(!crossover_bandit.load(resume->crossovers_statistics)
+		   || !wcrossover_bandit.load(resume->wcrossovers_statistics))
+		{
+			LOGGER->warn("({}) Memetic resumed without the operators statistics", m_problem.name);
+			crossover_bandit = adaptive::ucb(adaptive::operators_number<Crossover>());
+			wcrossover_bandit = adaptive::ucb(adaptive::operators_number<WeightsCrossover>());
+			pin<Crossover>(crossover_bandit, config.crossover);
+			pin<WeightsCrossover>(wcrossover_bandit, config.wcrossover);
+		}
+		crossover_selected = std::min(resume->crossover_selected,
+		                              adaptive::operators_number<Crossover>() - 1);
+		wcrossover_selected = std::min(resume->wcrossover_selected,
+		                               adaptive::operators_number<WeightsCrossover>() - 1);
+		offspring_parents_best = resume->offspring_parents_best;
+		offspring_time = resume->offspring_time;
+		report.phases = resume->phases;
+		report.generations_phases = resume->generations_phases;
+		load_subsets(resume->solution_best, report.solution_final);
+		report.points_weights_final = resume->points_weights_best;
+		report.found_at = resume->found_at;
+		best_solution_subsets_number = report.solution_final.selected_subsets.count();
+		LOGGER->info("({}) Memetic resumed at generation {} with best solution of {} subsets",
+		             m_problem.name,
+		             generation,
+		             best_solution_subsets_number);
+	}
+
+	// Checkpoints: written in background at the start of the generations
+	std::optional<async_file_writer> checkpoint_writer;
+	if(islands_mailboxes == nullptr && !config.checkpoint_path.empty())
+	{
+		checkpoint_writer.emplace(config.checkpoint_path);
+	}
+	double last_checkpoint_time = timer.elapsed();
+	auto save_subsets = [](const solution& solution) noexcept {
+		std::vector<size_t> subsets;
+		subsets.reserve(solution.selected_subsets.count());
+		solution.selected_subsets.iterate_bits_on(
+		  [&](size_t bit_on) noexcept { subsets.push_back(bit_on); });
+		return subsets;
+	};
+
+	// Phases time: time since the last lap attributed to a phase
+	phases_time generation_phases;
+	::timer phase_timer;
+	auto lap = [&phase_timer](double& phase) noexcept {
+		phase += phase_timer.elapsed();
+		phase_timer.reset();
+	};
+	auto end_generation_phases = [&]() noexcept {
+		lap(generation_phases.other);
+		report.phases += generation_phases;
+		report.generations_phases.push_back(generation_phases);
+	};
+
 	// Main loop
 	while(generation < config.stopping_criterion.generation
 	      && rwls_cumulative_position < config.stopping_criterion.rwls_cumulative_position
-	      && timer.elapsed() < config.stopping_criterion.time)
+	      && timer.elapsed() < config.stopping_criterion.time
+	      && best_solution_subsets_number > config.lower_bound
+	      && (islands_mailboxes == nullptr || !islands_mailboxes->stop_requested()))
 	{
+		generation_phases = {};
+		phase_timer.reset();
 		LOGGER->info("[------------------------------] ({}) Memetic generation {}, start at {}s",
 		             m_problem.name,
 		             generation,
 		             timer.elapsed());
+		lap(generation_phases.logging);
+
+		if(checkpoint_writer && timer.elapsed() - last_checkpoint_time >= config.checkpoint_period)
+		{
+			checkpoint state;
+			state.problem_name = m_problem.name;
+			state.points_number = m_problem.points_number;
+			state.subsets_number = m_problem.subsets_number;
+			state.crossover_operator = report.crossover_operator;
+			state.wcrossover_operator = report.wcrossover_operator;
+			state.progress = config.checkpoint_progress;
+			state.generator = generator;
+			state.individuals_generators = individuals_generators;
+			state.generation = generation;
+			state.rwls_cumulative_position = rwls_cumulative_position;
+			state.time = timer.elapsed();
+			state.rwls_steps = config.rwls_stopping_criterion.steps;
+			state.dynamic_steps.assign(dynamic_steps.cbegin(), dynamic_steps.cend());
+			state.parents_order = parents_order;
+			state.population.reserve(population_size);
+			for(const solution& individual: population)
+			{
+				state.population.push_back(save_subsets(individual));
+			}
+			state.population_weights = population_weights;
+			state.explored = explored.hashes();
+			state.solution_best = save_subsets(report.solution_final);
+			state.points_weights_best = report.points_weights_final;
+			state.found_at = report.found_at;
+			state.crossovers_statistics = crossover_bandit.statistics();
+			state.wcrossovers_statistics = wcrossover_bandit.statistics();
+			state.crossover_selected = crossover_selected;
+			state.wcrossover_selected = wcrossover_selected;
+			state.offspring_parents_best = offspring_parents_best;
+			state.offspring_time = offspring_time;
+			state.phases = report.phases;
+			state.generations_phases = report.generations_phases;
+			checkpoint_writer->write(state.serialize());
+			last_checkpoint_time = state.time;
+			LOGGER->info("({}) M g{}: checkpoint saved", m_problem.name, generation);
+		}
+		lap(generation_phases.other);
+
+		// no RWLS budget spent twice on the same solution: replaced by a random solution
+		size_t explored_individuals = 0;
+		for(size_t i = 0; i < population.size(); ++i)
+		{
+			if(explored.insert(population[i]))
+			{
+				population[i] = uscp::random::point_solve(
+				  individuals_generators[i], m_problem, m_points_subsets, true, NULL_LOGGER);
+				offspring_parents_best[i] = 0;
+				++explored_individuals;
+			}
+		}
+		lap(generation_phases.restarts);
+		if(explored_individuals > 0)
+		{
+			LOGGER->info("({}) M g{}: {} individuals already explored: randomize them",
+			             m_problem.name,
+			             generation,
+			             explored_individuals);
+		}
+		lap(generation_phases.logging);
+
+		// RWLS durations vary a lot between individuals: dynamic scheduling
 #pragma omp parallel for default(none) \
-  shared(population, population_weights, rwls_reports, config, generator)
+  shared(population, population_weights, rwls_reports, config, individuals_generators) \
+    schedule(dynamic) num_threads(threads_number)
 		for(/*no size_t for openMP on Windows*/ int i_int = 0;
 		    i_int < static_cast<int>(population.size());
 		    ++i_int)
 		{
 			const size_t i = static_cast<size_t>(i_int);
-			rwls_reports[i] = m_rwls.improve(
-			  population[i], population_weights[i], generator, config.rwls_stopping_criterion);
+			rwls_reports[i] = m_rwls.improve(population[i],
+			                                 population_weights[i],
+			                                 individuals_generators[i],
+			                                 config.rwls_stopping_criterion);
 		}
+		lap(generation_phases.rwls);
+
+		// reward the operators of the previous generation
+		if(generation > 0)
+		{
+			size_t improvement = 0;
+			double time = 0;
+			for(size_t i = 0; i < population_size; ++i)
+			{
+				const size_t subsets_number = rwls_reports[i].solution_final.selected_subsets.count();
+				if(offspring_parents_best[i] > subsets_number)
+				{
+					improvement += offspring_parents_best[i] - subsets_number;
+				}
+				time += offspring_time[i] + rwls_reports[i].ended_at.time;
+			}
+			crossover_bandit.update(crossover_selected, improvement, time);
+			wcrossover_bandit.update(wcrossover_selected, improvement, time);
+		}
+
 		for(size_t i = 0; i < rwls_reports.size(); ++i)
 		{
 			const size_t solution_subsets_number =
@@ -160,80 +869,101 @@ uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve
 				report.found_at.time = timer.elapsed();
 				report.points_weights_final = rwls_reports[i].points_weights_final;
 				best_solution_subsets_number = solution_subsets_number;
+				lap(generation_phases.other);
 				LOGGER->info(
 				  "({}) Memetic new best solution with {} subsets at generation {} in {}s",
 				  m_problem.name,
 				  solution_subsets_number,
 				  generation,
 				  timer.elapsed());
+				lap(generation_phases.logging);
 			}
 		}
+		if(best_solution_subsets_number <= config.lower_bound)
+		{
+			lap(generation_phases.other);
+			LOGGER->info("({}) M g{}: lower bound reached: solution is optimal",
+			             m_problem.name,
+			             generation);
+			lap(generation_phases.logging);
+			end_generation_phases();
+			break;
+		}
+		size_t parents_found_at_steps = 0;
+		size_t parents_min_subsets_number = std::numeric_limits<size_t>::max();
+		size_t parents_max_subsets_number = 0;
 		for(size_t i = 0; i < rwls_reports.size(); ++i)
 		{
 			rwls_cumulative_position += rwls_reports[i].ended_at;
+			parents_found_at_steps += rwls_reports[i].found_at.steps;
+			const size_t subsets_number = rwls_reports[i].solution_final.selected_subsets.count();
+			parents_subsets_number[i] = subsets_number;
+			parents_min_subsets_number = std::min(parents_min_subsets_number, subsets_number);
+			parents_max_subsets_number = std::max(parents_max_subsets_number, subsets_number);
 		}
+		lap(generation_phases.other);
 		LOGGER->info("({}) M g{}: applied {} RWLS steps to get parents",
 		             m_problem.name,
 		             generation,
 		             config.rwls_stopping_criterion.steps);
-		LOGGER->info("({}) M g{}: parents found at: ({}, {})",
+		LOGGER->info("({}) M g{}: parents found at {} steps on average",
 		             m_problem.name,
 		             generation,
-		             rwls_reports[0].found_at.steps,
-		             rwls_reports[1].found_at.steps);
-		LOGGER->info("({}) M g{}: parents subsets: ({}, {}){}",
+		             parents_found_at_steps / population_size);
+		LOGGER->info("({}) M g{}: parents subsets: [{}, {}]",
 		             m_problem.name,
 		             generation,
-		             rwls_reports[0].solution_final.selected_subsets.count(),
-		             rwls_reports[1].solution_final.selected_subsets.count(),
-		             rwls_reports[0].solution_final.selected_subsets
-		                 == rwls_reports[1].solution_final.selected_subsets
-		               ? " [same]"
-		               : "");
-
-		if(rwls_reports[0].found_at.steps == 0 || rwls_reports[1].found_at.steps == 0)
+		             parents_min_subsets_number,
+		             parents_max_subsets_number);
+		lap(generation_phases.logging);
+
+		const bool rwls_stalled =
+		  std::any_of(rwls_reports.cbegin(),
+		              rwls_reports.cend(),
+		              [](const uscp::rwls::report& rwls_report) noexcept {
+			              return rwls_report.found_at.steps == 0;
+		              });
+		lap(generation_phases.other);
+		if(rwls_stalled)
 		{
 			LOGGER->info(
-			  "({}) M g{}: RWLS did not change the parents: randomize parents and double RWLS steps of next generation",
+			  "({}) M g{}: RWLS did not change some parents: randomize them and double RWLS steps of next generation",
 			  m_problem.name,
 			  generation);
+			lap(generation_phases.logging);
 			config.rwls_stopping_criterion.steps *= 2;
-			rwls_reports[0].solution_final = uscp::random::solve(generator, m_problem, NULL_LOGGER);
-			rwls_reports[1].solution_final = uscp::random::solve(generator, m_problem, NULL_LOGGER);
-			LOGGER->info("({}) M g{}: new parents subsets: ({}, {}){}",
-			             m_problem.name,
-			             generation,
-			             rwls_reports[0].solution_final.selected_subsets.count(),
-			             rwls_reports[1].solution_final.selected_subsets.count(),
-			             rwls_reports[0].solution_final.selected_subsets
-			                 == rwls_reports[1].solution_final.selected_subsets
-			               ? " [same]"
-			               : "");
+			for(uscp::rwls::report& rwls_report: rwls_reports)
+			{
+				if(rwls_report.found_at.steps == 0)
+				{
+					rwls_report.solution_final = uscp::random::point_solve(
+					  generator, m_problem, m_points_subsets, true, NULL_LOGGER);
+				}
+			}
+			lap(generation_phases.restarts);
 		}
 		else
 		{
-			if(rwls_reports[0].solution_final.selected_subsets
-			   == rwls_reports[1].solution_final.selected_subsets)
+			for(size_t i = 1; i < rwls_reports.size(); ++i)
 			{
-				LOGGER->info(
-				  "({}) M g{}: same parents: randomize parents", m_problem.name, generation);
-				rwls_reports[0].solution_final =
-				  uscp::random::solve(generator, m_problem, NULL_LOGGER);
-				rwls_reports[1].solution_final =
-				  uscp::random::solve(generator, m_problem, NULL_LOGGER);
-				LOGGER->info("({}) M g{}: new parents subsets: ({}, {}){}",
-				             m_problem.name,
-				             generation,
-				             rwls_reports[0].solution_final.selected_subsets.count(),
-				             rwls_reports[1].solution_final.selected_subsets.count(),
-				             rwls_reports[0].solution_final.selected_subsets
-				                 == rwls_reports[1].solution_final.selected_subsets
-				               ? " [same]"
-				               : "");
+				for(size_t j = 0; j < i; ++j)
+				{
+					if(rwls_reports[i].solution_final.same_subsets(rwls_reports[j].solution_final))
+					{
+						LOGGER->info("({}) M g{}: same parents: randomize parent {}",
+						             m_problem.name,
+						             generation,
+						             i);
+						rwls_reports[i].solution_final = uscp::random::point_solve(
+						  generator, m_problem, m_points_subsets, true, NULL_LOGGER);
+						break;
+					}
+				}
 			}
+			lap(generation_phases.restarts);
 
-			dynamic_steps.push_back(rwls_reports[0].found_at.steps
-			                        + rwls_reports[1].found_at.steps);
+			// found at steps of a pair of parents
+			dynamic_steps.push_back(2 * parents_found_at_steps / population_size);
 			dynamic_steps.pop_front();
 			config.rwls_stopping_criterion.steps =
 			  base_steps
@@ -241,53 +971,153 @@ uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve
 			      / dynamic_steps.size();
 		}
 
-#pragma omp parallel sections
+		// migration: send the island best solution to the next island and replace the worst
+		// parent by the best solution received from the previous island
+		if(islands_mailboxes != nullptr && config.migration_interval > 0
+		   && (generation + 1) % config.migration_interval == 0)
 		{
-#pragma omp section
+			std::shared_ptr<migrant> migrant_out =
+			  std::make_shared<migrant>(migrant{report.solution_final, report.points_weights_final});
+			if(migrant_out->points_weights.empty())
 			{
-				population[0] = m_crossover.apply1(
-				  rwls_reports[0].solution_final, rwls_reports[1].solution_final, generator);
+				migrant_out->points_weights.resize(m_problem.points_number, 1);
 			}
-#pragma omp section
+			islands_mailboxes->post(island, std::move(migrant_out));
+
+			const size_t islands_number = islands_mailboxes->islands_number();
+			const size_t previous_island = (island + islands_number - 1) % islands_number;
+			const std::shared_ptr<const migrant> migrant_in =
+			  islands_mailboxes->read(previous_island);
+			if(migrant_in
+			   && std::none_of(rwls_reports.cbegin(),
+			                   rwls_reports.cend(),
+			                   [&](const uscp::rwls::report& rwls_report) noexcept {
+				                   return rwls_report.solution_final.same_subsets(
+				                     migrant_in->solution_best);
+			                   }))
 			{
-				population[1] = m_crossover.apply2(
-				  rwls_reports[0].solution_final, rwls_reports[1].solution_final, generator);
+				uscp::rwls::report& worst_parent = *std::max_element(
+				  rwls_reports.begin(),
+				  rwls_reports.end(),
+				  [](const uscp::rwls::report& a, const uscp::rwls::report& b) noexcept {
+					  return a.solution_final.selected_subsets.count()
+					         < b.solution_final.selected_subsets.count();
+				  });
+				worst_parent.solution_final = migrant_in->solution_best;
+				worst_parent.points_weights_final = migrant_in->points_weights;
+				LOGGER->info("({}) M g{}: island {} received solution with {} subsets from island {}",
+				             m_problem.name,
+				             generation,
+				             island,
+				             migrant_in->solution_best.selected_subsets.count(),
+				             previous_island);
 			}
 		}
-		LOGGER->info("({}) M g{}: children subsets: ({}, {}){}",
-		             m_problem.name,
-		             generation,
-		             population[0].selected_subsets.count(),
-		             population[1].selected_subsets.count(),
-		             population[0].selected_subsets == population[1].selected_subsets ? " [same]"
-		                                                                              : "");
 
-#pragma omp parallel sections
+		// children of (a, b) are apply1(a, b) and apply2(a, b), with an odd population size
+		// the last parent is also paired with the first one
+		crossover_selected = crossover_bandit.select();
+		wcrossover_selected = wcrossover_bandit.select();
+		lap(generation_phases.other);
+		if(adaptive::operators_number<Crossover>() > 1
+		   || adaptive::operators_number<WeightsCrossover>() > 1)
 		{
-#pragma omp section
+			LOGGER->info("({}) M g{}: selected operators {}/{}",
+			             m_problem.name,
+			             generation,
+			             adaptive::operator_name<Crossover>(crossover_selected),
+			             adaptive::operator_name<WeightsCrossover>(wcrossover_selected));
+		}
+		lap(generation_phases.logging);
+		std::shuffle(parents_order.begin(), parents_order.end(), generator);
+		lap(generation_phases.other);
+#pragma omp parallel for default(none) \
+  shared(population, population_weights, rwls_reports, parents_order, individuals_generators) \
+    shared(crossover_selected, wcrossover_selected, parents_subsets_number) \
+      shared(offspring_parents_best, offspring_time, offspring_wcrossover_time) schedule(dynamic) \
+        num_threads(threads_number)
+		for(/*no size_t for openMP on Windows*/ int i_int = 0;
+		    i_int < static_cast<int>(parents_order.size());
+		    ++i_int)
+		{
+			const size_t i = static_cast<size_t>(i_int);
+			const size_t child = parents_order[i];
+			random_engine& child_generator = individuals_generators[child];
+			const ::timer crossover_timer;
+			::timer wcrossover_timer;
+			const size_t other = i % 2 == 0 ? parents_order[(i + 1) % parents_order.size()]
+			                                 : parents_order[i - 1];
+			if(i % 2 == 0)
 			{
-				population_weights[0] = m_wcrossover.apply1(rwls_reports[0].points_weights_final,
-				                                            rwls_reports[0].points_weights_final,
-				                                            generator);
+				population[child] = adaptive::apply1(m_crossover,
+				                                     crossover_selected,
+				                                     rwls_reports[child].solution_final,
+				                                     rwls_reports[other].solution_final,
+				                                     child_generator);
+				wcrossover_timer.reset();
+				// weights written in the buffer of the previous generation
+				adaptive::apply1(m_wcrossover,
+				                 wcrossover_selected,
+				                 rwls_reports[child].points_weights_final,
+				                 rwls_reports[other].points_weights_final,
+				                 population_weights[child],
+				                 child_generator);
 			}
-#pragma omp section
+			else
 			{
-				population_weights[1] = m_wcrossover.apply2(rwls_reports[0].points_weights_final,
-				                                            rwls_reports[0].points_weights_final,
-				                                            generator);
+				population[child] = adaptive::apply2(m_crossover,
+				                                     crossover_selected,
+				                                     rwls_reports[other].solution_final,
+				                                     rwls_reports[child].solution_final,
+				                                     child_generator);
+				wcrossover_timer.reset();
+				// weights written in the buffer of the previous generation
+				adaptive::apply2(m_wcrossover,
+				                 wcrossover_selected,
+				                 rwls_reports[other].points_weights_final,
+				                 rwls_reports[child].points_weights_final,
+				                 population_weights[child],
+				                 child_generator);
 			}
+			offspring_wcrossover_time[child] = wcrossover_timer.elapsed();
+			offspring_parents_best[child] =
+			  std::min(parents_subsets_number[child], parents_subsets_number[other]);
+			offspring_time[child] = crossover_timer.elapsed();
+		}
+		{
+			// parallel region wall time split as the time cumulated over the threads
+			const double wcrossover_time = std::accumulate(
+			  offspring_wcrossover_time.cbegin(), offspring_wcrossover_time.cend(), 0.0);
+			const double offspring_total_time =
+			  std::accumulate(offspring_time.cbegin(), offspring_time.cend(), 0.0);
+			const double wcrossover_share =
+			  offspring_total_time > 0 ? wcrossover_time / offspring_total_time : 0;
+			const double region_time = phase_timer.elapsed();
+			phase_timer.reset();
+			generation_phases.crossover += region_time * (1 - wcrossover_share);
+			generation_phases.wcrossover += region_time * wcrossover_share;
 		}
 		LOGGER->info("({}) M g{}: current best solution subsets number: {}",
 		             m_problem.name,
 		             generation,
 		             best_solution_subsets_number);
+		lap(generation_phases.logging);
+		end_generation_phases();
 
 		++generation;
 	}
+	if(islands_mailboxes != nullptr && best_solution_subsets_number <= config.lower_bound)
+	{
+		islands_mailboxes->request_stop();
+	}
 
 	report.ended_at.generation = generation;
 	report.ended_at.rwls_cumulative_position = rwls_cumulative_position;
 	report.ended_at.time = timer.elapsed();
+	report.crossovers_statistics = statistics<Crossover>(crossover_bandit);
+	report.wcrossovers_statistics = statistics<WeightsCrossover>(wcrossover_bandit);
+	// initialization and time between the generations
+	report.phases.other += std::max(report.ended_at.time - report.phases.total(), 0.0);
 
 	LOGGER->info("({}) Memetic found solution with {} subsets in {}s",
 	             m_problem.name,
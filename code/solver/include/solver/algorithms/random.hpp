@@ -12,6 +12,7 @@
 #include "common/data/solution.hpp"
 #include "common/utils/random.hpp"
 #include "common/utils/logger.hpp"
+#include "solver/algorithms/subproblem.hpp"
 
 namespace uscp::random
 {
@@ -24,6 +25,15 @@ namespace uscp::random
 	  const problem::instance& problem,
 	  const dynamic_bitset<>& authorized_subsets,
 	  std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
+
+	// random uncovered point, then random subset covering it, until all points are covered:
+	// only the points of the selected subsets are visited, the subsets made redundant by the
+	// next ones are removed at the end if requested
+	[[nodiscard]] solution point_solve(random_engine& generator,
+	                                   const problem::instance& problem,
+	                                   const subproblem::points_subsets& points_subsets,
+	                                   bool remove_redundant = false,
+	                                   std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
 } // namespace uscp::random
 
 #endif //USCP_RANDOM_HPP
@@ -0,0 +1,32 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_REDUNDANCY_HPP
+#define USCP_REDUNDANCY_HPP
+
+#include "common/data/solution.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace uscp::redundancy
+{
+	// removes in one pass the selected subsets whose points are all covered by other selected
+	// subsets, with the number of selected subsets covering each point: the subsets are checked
+	// in the given order, the selected subsets not in it are kept
+	[[gnu::hot]] void remove_ordered(solution& solution,
+	                                 const std::vector<size_t>& subsets_order) noexcept;
+
+	// the subsets covering the fewest points first
+	[[gnu::hot]] void remove(solution& solution) noexcept;
+
+	// the subsets covering the lowest points weight first
+	[[gnu::hot]] void remove_weighted(solution& solution,
+	                                  const std::vector<long long>& points_weights) noexcept;
+} // namespace uscp::redundancy
+
+#endif //USCP_REDUNDANCY_HPP
@@ -72,6 +72,10 @@ namespace uscp::rwls
 		rwls& operator=(rwls&& other) noexcept = delete;
 
 		[[gnu::hot]] void initialize() noexcept;
+
+		// stop as soon as a solution with lower_bound subsets is found: it is optimal
+		void set_lower_bound(size_t lower_bound) noexcept;
+
 		[[nodiscard, gnu::hot]] report improve(const uscp::solution& solution,
 		                                       random_engine& generator,
 		                                       position stopping_criterion) noexcept;
@@ -167,6 +171,7 @@ namespace uscp::rwls
 		std::vector<std::vector<size_t>> m_subsets_points;
 		std::vector<std::vector<size_t>> m_subsets_covering_points;
 		bool m_initialized;
+		size_t m_lower_bound;
 		const std::shared_ptr<spdlog::logger> m_logger;
 	};
 
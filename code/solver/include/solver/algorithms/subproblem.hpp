@@ -0,0 +1,47 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_SUBPROBLEM_HPP
+#define USCP_SUBPROBLEM_HPP
+
+#include "common/data/instance.hpp"
+
+#include <dynamic_bitset.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace uscp::subproblem
+{
+	// subsets covering each point, sparse index shared by the subproblems of an instance
+	class points_subsets final
+	{
+	public:
+		explicit points_subsets(const problem::instance& problem) noexcept;
+		points_subsets(const points_subsets&) = default;
+		points_subsets(points_subsets&&) noexcept = default;
+		points_subsets& operator=(const points_subsets& other) = delete;
+		points_subsets& operator=(points_subsets&& other) noexcept = delete;
+
+		// instance of the authorized subsets after the domination and inclusion reductions,
+		// applied until none of them reduces it further, its solutions are expanded as reduced ones
+		// only the points of the authorized subsets are visited
+		[[nodiscard, gnu::hot]] problem::instance reduce(
+		  const dynamic_bitset<>& authorized_subsets) const noexcept;
+
+		// subsets covering the point, in increasing order
+		[[nodiscard]] size_t subsets_number(size_t point) const noexcept;
+		[[nodiscard]] size_t subset(size_t point, size_t i) const noexcept;
+
+	private:
+		const problem::instance& m_problem;
+		std::vector<size_t> m_points_subsets_begin;
+		std::vector<size_t> m_points_subsets;
+	};
+} // namespace uscp::subproblem
+
+#endif //USCP_SUBPROBLEM_HPP
@@ -15,6 +15,7 @@
 #include <dynamic_bitset.hpp>
 
 #include <string_view>
+#include <vector>
 #include <algorithm>
 
 namespace uscp::wcrossover
@@ -29,33 +30,52 @@ namespace uscp::wcrossover
 		difference& operator=(const difference& other) = delete;
 		difference& operator=(difference&& other) noexcept = delete;
 
-		[[nodiscard]] std::vector<long long> apply(const std::vector<long long>& a,
-		                                           const std::vector<long long>& b) const noexcept
+		void apply(const std::vector<long long>& a,
+		           const std::vector<long long>& b,
+		           std::vector<long long>& weights) const noexcept
 		{
-			std::vector<long long> weights;
-			weights.reserve(problem.points_number);
+			weights.resize(problem.points_number);
 			std::transform(std::cbegin(a),
 			               std::cend(a),
 			               std::cbegin(b),
-			               std::back_inserter(weights),
+			               std::begin(weights),
 			               [](long long wa, long long wb) { return wa > wb ? wa - wb : wb - wa; });
-			return weights;
 		}
 
 		std::vector<long long> apply1(const std::vector<long long>& a,
 		                              const std::vector<long long>& b,
-		                              [[maybe_unused]] random_engine& generator) const noexcept
+		                              random_engine& generator) const noexcept
+		{
+			std::vector<long long> weights;
+			apply1(a, b, weights, generator);
+			return weights;
+		}
+
+		void apply1(const std::vector<long long>& a,
+		            const std::vector<long long>& b,
+		            std::vector<long long>& weights,
+		            [[maybe_unused]] random_engine& generator) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			return apply(a, b);
+			apply(a, b, weights);
 		}
 
 		std::vector<long long> apply2(const std::vector<long long>& a,
 		                              const std::vector<long long>& b,
-		                              [[maybe_unused]] random_engine& generator) const noexcept
+		                              random_engine& generator) const noexcept
+		{
+			std::vector<long long> weights;
+			apply2(a, b, weights, generator);
+			return weights;
+		}
+
+		void apply2(const std::vector<long long>& a,
+		            const std::vector<long long>& b,
+		            std::vector<long long>& weights,
+		            [[maybe_unused]] random_engine& generator) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			return apply(a, b);
+			apply(a, b, weights);
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
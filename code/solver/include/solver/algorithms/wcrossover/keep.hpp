@@ -15,6 +15,7 @@
 #include <dynamic_bitset.hpp>
 
 #include <string_view>
+#include <vector>
 
 namespace uscp::wcrossover
 {
@@ -29,19 +30,39 @@ namespace uscp::wcrossover
 		keep& operator=(keep&& other) noexcept = delete;
 
 		std::vector<long long> apply1(const std::vector<long long>& a,
-		                              [[maybe_unused]] const std::vector<long long>& b,
-		                              [[maybe_unused]] random_engine& generator) const noexcept
+		                              const std::vector<long long>& b,
+		                              random_engine& generator) const noexcept
+		{
+			std::vector<long long> weights;
+			apply1(a, b, weights, generator);
+			return weights;
+		}
+
+		void apply1(const std::vector<long long>& a,
+		            [[maybe_unused]] const std::vector<long long>& b,
+		            std::vector<long long>& weights,
+		            [[maybe_unused]] random_engine& generator) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			return a;
+			weights = a;
 		}
 
-		std::vector<long long> apply2([[maybe_unused]] const std::vector<long long>& a,
+		std::vector<long long> apply2(const std::vector<long long>& a,
 		                              const std::vector<long long>& b,
-		                              [[maybe_unused]] random_engine& generator) const noexcept
+		                              random_engine& generator) const noexcept
+		{
+			std::vector<long long> weights;
+			apply2(a, b, weights, generator);
+			return weights;
+		}
+
+		void apply2([[maybe_unused]] const std::vector<long long>& a,
+		            const std::vector<long long>& b,
+		            std::vector<long long>& weights,
+		            [[maybe_unused]] random_engine& generator) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			return b;
+			weights = b;
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
@@ -15,6 +15,9 @@
 #include <dynamic_bitset.hpp>
 
 #include <string_view>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
 
 namespace uscp::wcrossover
 {
@@ -28,34 +31,59 @@ namespace uscp::wcrossover
 		mix_random& operator=(const mix_random& other) = delete;
 		mix_random& operator=(mix_random&& other) noexcept = delete;
 
-		[[nodiscard]] std::vector<long long> apply(const std::vector<long long>& a,
-		                                           const std::vector<long long>& b,
-		                                           random_engine& generator) const noexcept
+		// one random word selects the parent of 64 points
+		void apply(const std::vector<long long>& a,
+		           const std::vector<long long>& b,
+		           std::vector<long long>& weights,
+		           random_engine& generator) const noexcept
 		{
-			std::vector<long long> weights;
-			weights.reserve(problem.points_number);
-			std::bernoulli_distribution dist;
-			for(size_t i = 0; i < problem.points_number; ++i)
+			weights.resize(problem.points_number);
+			for(size_t i_block = 0; i_block < problem.points_number; i_block += 64)
 			{
-				weights.push_back(dist(generator) ? a[i] : b[i]);
+				const uint64_t selection = generator();
+				const size_t block_end = std::min(i_block + 64, problem.points_number);
+				for(size_t i = i_block; i < block_end; ++i)
+				{
+					const long long mask = -static_cast<long long>((selection >> (i - i_block)) & 1);
+					weights[i] = (a[i] & mask) | (b[i] & ~mask);
+				}
 			}
-			return weights;
 		}
 
 		std::vector<long long> apply1(const std::vector<long long>& a,
 		                              const std::vector<long long>& b,
 		                              random_engine& generator) const noexcept
+		{
+			std::vector<long long> weights;
+			apply1(a, b, weights, generator);
+			return weights;
+		}
+
+		void apply1(const std::vector<long long>& a,
+		            const std::vector<long long>& b,
+		            std::vector<long long>& weights,
+		            random_engine& generator) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			return apply(a, b, generator);
+			apply(a, b, weights, generator);
 		}
 
 		std::vector<long long> apply2(const std::vector<long long>& a,
 		                              const std::vector<long long>& b,
 		                              random_engine& generator) const noexcept
+		{
+			std::vector<long long> weights;
+			apply2(a, b, weights, generator);
+			return weights;
+		}
+
+		void apply2(const std::vector<long long>& a,
+		            const std::vector<long long>& b,
+		            std::vector<long long>& weights,
+		            random_engine& generator) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			return apply(a, b, generator);
+			apply(a, b, weights, generator);
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
@@ -15,6 +15,7 @@
 #include <dynamic_bitset.hpp>
 
 #include <string_view>
+#include <vector>
 
 namespace uscp::wcrossover
 {
@@ -36,6 +37,14 @@ namespace uscp::wcrossover
 			return weights;
 		}
 
+		void apply1([[maybe_unused]] const std::vector<long long>& a,
+		            [[maybe_unused]] const std::vector<long long>& b,
+		            std::vector<long long>& child_weights,
+		            [[maybe_unused]] random_engine& generator) const noexcept
+		{
+			child_weights = weights;
+		}
+
 		std::vector<long long> apply2([[maybe_unused]] const std::vector<long long>& a,
 		                              [[maybe_unused]] const std::vector<long long>& b,
 		                              [[maybe_unused]] random_engine& generator) const noexcept
@@ -43,6 +52,14 @@ namespace uscp::wcrossover
 			return weights;
 		}
 
+		void apply2([[maybe_unused]] const std::vector<long long>& a,
+		            [[maybe_unused]] const std::vector<long long>& b,
+		            std::vector<long long>& child_weights,
+		            [[maybe_unused]] random_engine& generator) const noexcept
+		{
+			child_weights = weights;
+		}
+
 		[[nodiscard]] static std::string_view to_string() noexcept
 		{
 			return "reset";
@@ -15,6 +15,7 @@
 #include <dynamic_bitset.hpp>
 
 #include <string_view>
+#include <vector>
 #include <algorithm>
 
 namespace uscp::wcrossover
@@ -30,23 +31,41 @@ namespace uscp::wcrossover
 		shuffle& operator=(shuffle&& other) noexcept = delete;
 
 		std::vector<long long> apply1(const std::vector<long long>& a,
-		                              [[maybe_unused]] const std::vector<long long>& b,
+		                              const std::vector<long long>& b,
 		                              random_engine& generator) const noexcept
+		{
+			std::vector<long long> weights;
+			apply1(a, b, weights, generator);
+			return weights;
+		}
+
+		void apply1(const std::vector<long long>& a,
+		            [[maybe_unused]] const std::vector<long long>& b,
+		            std::vector<long long>& weights,
+		            random_engine& generator) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			std::vector<long long> weights = a;
+			weights = a;
 			std::shuffle(std::begin(weights), std::end(weights), generator);
-			return weights;
 		}
 
-		std::vector<long long> apply2([[maybe_unused]] const std::vector<long long>& a,
+		std::vector<long long> apply2(const std::vector<long long>& a,
 		                              const std::vector<long long>& b,
 		                              random_engine& generator) const noexcept
+		{
+			std::vector<long long> weights;
+			apply2(a, b, weights, generator);
+			return weights;
+		}
+
+		void apply2([[maybe_unused]] const std::vector<long long>& a,
+		            const std::vector<long long>& b,
+		            std::vector<long long>& weights,
+		            random_engine& generator) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			std::vector<long long> weights = b;
+			weights = b;
 			std::shuffle(std::begin(weights), std::end(weights), generator);
-			return weights;
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
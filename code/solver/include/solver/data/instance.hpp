@@ -10,6 +10,7 @@
 
 #include "common/utils/random.hpp"
 #include "common/data/instance.hpp"
+#include "common/utils/logger.hpp"
 
 #include <string_view>
 #include <cstddef>
@@ -34,6 +35,12 @@ namespace uscp::problem
 
 	[[nodiscard, gnu::hot]] instance reduce(const instance& full_instance) noexcept;
 
+	// sub-instance of the parent instance without the removed subsets and points, only the
+	// points of the remaining subsets are visited
+	[[nodiscard, gnu::hot]] instance apply_reduction(
+	  reduction_info reduction,
+	  std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
+
 	[[nodiscard, gnu::hot]] instance reduce_cache(const instance& full_instance) noexcept;
 } // namespace uscp::problem
 
@@ -30,7 +30,8 @@ namespace uscp
 		     + instance.reduction->reduction_applied.subsets_included.count())
 		    != instance.reduction->parent_instance->subsets_number)
 		   || ((instance.points_number
-		        + instance.reduction->reduction_applied.points_covered.count())
+		        + instance.reduction->reduction_applied.points_covered.count()
+		        + instance.reduction->reduction_applied.points_dominated.count())
 		       != instance.reduction->parent_instance->points_number))
 		{
 			LOGGER->error("Tried to expand solution of an invalid reduced instance");
@@ -45,10 +46,12 @@ namespace uscp
 			abort();
 		}
 
+		const dynamic_bitset<> removed_points =
+		  instance.reduction->reduction_applied.removed_points();
 		std::vector<T> expanded_info;
 		expanded_info.resize(instance.reduction->parent_instance->points_number, default_value);
 		size_t i_expanded = 0;
-		while(instance.reduction->reduction_applied.points_covered.test(i_expanded))
+		while(removed_points.test(i_expanded))
 		{
 			++i_expanded;
 		}
@@ -64,7 +67,7 @@ namespace uscp
 				{
 					break;
 				}
-			} while(instance.reduction->reduction_applied.points_covered.test(i_expanded));
+			} while(removed_points.test(i_expanded));
 		}
 		assert(i_expanded == instance.reduction->parent_instance->points_number);
 		if(i_expanded != instance.reduction->parent_instance->points_number)
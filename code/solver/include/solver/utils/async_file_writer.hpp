@@ -0,0 +1,49 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_ASYNC_FILE_WRITER_HPP
+#define USCP_ASYNC_FILE_WRITER_HPP
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace uscp
+{
+	// write files in a background thread, the caller is never blocked by the disk
+	// only the last data is kept if a write is requested while another one is in progress
+	// the data is written to a temporary file then renamed: the file is never partially written
+	class async_file_writer final
+	{
+	public:
+		explicit async_file_writer(std::string path) noexcept;
+		async_file_writer(const async_file_writer&) = delete;
+		async_file_writer(async_file_writer&&) noexcept = delete;
+		async_file_writer& operator=(const async_file_writer& other) = delete;
+		async_file_writer& operator=(async_file_writer&& other) noexcept = delete;
+		~async_file_writer() noexcept; // pending data written before returning
+
+		void write(std::vector<char> data) noexcept;
+
+	private:
+		void run() noexcept;
+
+		const std::string m_path;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::optional<std::vector<char>> m_pending;
+		bool m_stop;
+		std::thread m_thread;
+	};
+
+	[[nodiscard]] std::optional<std::vector<char>> read_file(const std::string& path) noexcept;
+} // namespace uscp
+
+#endif //USCP_ASYNC_FILE_WRITER_HPP
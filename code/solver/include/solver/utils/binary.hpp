@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_BINARY_HPP
+#define USCP_BINARY_HPP
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace uscp
+{
+	// raw binary data in the native byte order: for files read back by the same build only
+	class binary_writer final
+	{
+	public:
+		binary_writer() noexcept = default;
+
+		template<typename T>
+		void write(const T& value) noexcept
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			const size_t position = m_data.size();
+			m_data.resize(position + sizeof(T));
+			std::memcpy(m_data.data() + position, &value, sizeof(T));
+		}
+
+		template<typename T>
+		void write(const std::vector<T>& values) noexcept
+		{
+			write(values.size());
+			for(const T& value: values)
+			{
+				write(value);
+			}
+		}
+
+		void write(const std::string& value) noexcept;
+
+		[[nodiscard]] std::vector<char>& data() noexcept;
+
+	private:
+		std::vector<char> m_data;
+	};
+
+	// read operations fail once the data is exhausted, the values are then left unchanged
+	class binary_reader final
+	{
+	public:
+		explicit binary_reader(const std::vector<char>& data) noexcept;
+
+		template<typename T>
+		bool read(T& value) noexcept
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			if(m_data.size() - m_position < sizeof(T))
+			{
+				return false;
+			}
+			std::memcpy(&value, m_data.data() + m_position, sizeof(T));
+			m_position += sizeof(T);
+			return true;
+		}
+
+		template<typename T>
+		bool read(std::vector<T>& values) noexcept
+		{
+			size_t size = 0;
+			if(!read(size))
+			{
+				return false;
+			}
+			// each value needs at least one byte: avoid huge allocations on corrupted data
+			if(size > m_data.size() - m_position)
+			{
+				return false;
+			}
+			values.resize(size);
+			for(T& value: values)
+			{
+				if(!read(value))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		bool read(std::string& value) noexcept;
+
+		[[nodiscard]] bool finished() const noexcept;
+
+	private:
+		const std::vector<char>& m_data;
+		size_t m_position;
+	};
+} // namespace uscp
+
+#endif //USCP_BINARY_HPP
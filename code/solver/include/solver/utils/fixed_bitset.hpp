@@ -0,0 +1,288 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_FIXED_BITSET_HPP
+#define USCP_FIXED_BITSET_HPP
+
+#include <dynamic_bitset.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+namespace uscp
+{
+	namespace fixed_bitset_detail
+	{
+		[[nodiscard]] inline size_t popcount(uint64_t block) noexcept
+		{
+#if defined(__GNUC__)
+			return static_cast<size_t>(__builtin_popcountll(block));
+#else
+			size_t count = 0;
+			for(; block != 0; block &= block - 1)
+			{
+				++count;
+			}
+			return count;
+#endif
+		}
+
+		[[nodiscard]] inline size_t count_trailing_zeros(uint64_t block) noexcept
+		{
+			assert(block != 0);
+#if defined(__GNUC__)
+			return static_cast<size_t>(__builtin_ctzll(block));
+#else
+			size_t count = 0;
+			for(; (block & 1) == 0; block >>= 1)
+			{
+				++count;
+			}
+			return count;
+#endif
+		}
+	} // namespace fixed_bitset_detail
+
+	// bitset with the dynamic_bitset operations used by the solvers and an inline storage
+	// of Blocks 64-bit blocks: no allocation and loops unrolled on the blocks, the bits after
+	// the size are always 0
+	template<size_t Blocks>
+	class fixed_bitset final
+	{
+	public:
+		static constexpr size_t bits_per_block = 64;
+		static constexpr size_t max_size = Blocks * bits_per_block;
+
+		explicit fixed_bitset(size_t size = 0) noexcept: m_blocks(), m_size(size)
+		{
+			assert(size <= max_size);
+		}
+
+		explicit fixed_bitset(const dynamic_bitset<>& bitset) noexcept: fixed_bitset(bitset.size())
+		{
+			bitset.iterate_bits_on([&](size_t bit) noexcept { set(bit); });
+		}
+
+		fixed_bitset(const fixed_bitset&) noexcept = default;
+		fixed_bitset(fixed_bitset&&) noexcept = default;
+		fixed_bitset& operator=(const fixed_bitset& other) noexcept = default;
+		fixed_bitset& operator=(fixed_bitset&& other) noexcept = default;
+
+		[[nodiscard]] size_t size() const noexcept
+		{
+			return m_size;
+		}
+
+		[[nodiscard]] bool test(size_t bit) const noexcept
+		{
+			assert(bit < m_size);
+			return (m_blocks[bit / bits_per_block] >> (bit % bits_per_block)) & 1;
+		}
+
+		[[nodiscard]] bool operator[](size_t bit) const noexcept
+		{
+			return test(bit);
+		}
+
+		fixed_bitset& set(size_t bit) noexcept
+		{
+			assert(bit < m_size);
+			m_blocks[bit / bits_per_block] |= uint64_t(1) << (bit % bits_per_block);
+			return *this;
+		}
+
+		fixed_bitset& set() noexcept
+		{
+			for(size_t i = 0; i < Blocks; ++i)
+			{
+				m_blocks[i] = block_mask(i);
+			}
+			return *this;
+		}
+
+		fixed_bitset& reset(size_t bit) noexcept
+		{
+			assert(bit < m_size);
+			m_blocks[bit / bits_per_block] &= ~(uint64_t(1) << (bit % bits_per_block));
+			return *this;
+		}
+
+		fixed_bitset& reset() noexcept
+		{
+			m_blocks.fill(0);
+			return *this;
+		}
+
+		fixed_bitset& operator|=(const fixed_bitset& other) noexcept
+		{
+			for(size_t i = 0; i < Blocks; ++i)
+			{
+				m_blocks[i] |= other.m_blocks[i];
+			}
+			return *this;
+		}
+
+		fixed_bitset& operator&=(const fixed_bitset& other) noexcept
+		{
+			for(size_t i = 0; i < Blocks; ++i)
+			{
+				m_blocks[i] &= other.m_blocks[i];
+			}
+			return *this;
+		}
+
+		fixed_bitset& operator-=(const fixed_bitset& other) noexcept
+		{
+			for(size_t i = 0; i < Blocks; ++i)
+			{
+				m_blocks[i] &= ~other.m_blocks[i];
+			}
+			return *this;
+		}
+
+		[[nodiscard]] size_t count() const noexcept
+		{
+			size_t count = 0;
+			for(size_t i = 0; i < Blocks; ++i)
+			{
+				count += fixed_bitset_detail::popcount(m_blocks[i]);
+			}
+			return count;
+		}
+
+		[[nodiscard]] bool all() const noexcept
+		{
+			for(size_t i = 0; i < Blocks; ++i)
+			{
+				if(m_blocks[i] != block_mask(i))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		[[nodiscard]] bool any() const noexcept
+		{
+			for(size_t i = 0; i < Blocks; ++i)
+			{
+				if(m_blocks[i] != 0)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		[[nodiscard]] bool none() const noexcept
+		{
+			return !any();
+		}
+
+		// same as dynamic_bitset: stops if the function returns false
+		template<typename Function>
+		void iterate_bits_on(Function&& function) const
+		  noexcept(noexcept(function(size_t(0))))
+		{
+			for(size_t i = 0; i < Blocks; ++i)
+			{
+				for(uint64_t block = m_blocks[i]; block != 0; block &= block - 1)
+				{
+					const size_t bit =
+					  i * bits_per_block + fixed_bitset_detail::count_trailing_zeros(block);
+					if constexpr(std::is_same_v<decltype(function(bit)), void>)
+					{
+						function(bit);
+					}
+					else
+					{
+						if(!function(bit))
+						{
+							return;
+						}
+					}
+				}
+			}
+		}
+
+		[[nodiscard]] friend fixed_bitset operator-(fixed_bitset lhs, const fixed_bitset& rhs) noexcept
+		{
+			lhs -= rhs;
+			return lhs;
+		}
+
+		[[nodiscard]] friend bool operator==(const fixed_bitset& lhs, const fixed_bitset& rhs) noexcept
+		{
+			return lhs.m_size == rhs.m_size && lhs.m_blocks == rhs.m_blocks;
+		}
+
+		[[nodiscard]] friend bool operator!=(const fixed_bitset& lhs, const fixed_bitset& rhs) noexcept
+		{
+			return !(lhs == rhs);
+		}
+
+	private:
+		[[nodiscard]] uint64_t block_mask(size_t block) const noexcept
+		{
+			const size_t begin = block * bits_per_block;
+			if(begin >= m_size)
+			{
+				return 0;
+			}
+			if(m_size - begin >= bits_per_block)
+			{
+				return ~uint64_t(0);
+			}
+			return (uint64_t(1) << (m_size - begin)) - 1;
+		}
+
+		std::array<uint64_t, Blocks> m_blocks;
+		size_t m_size;
+	};
+
+	// blocks number of the fixed bitsets the solvers are specialized for, 0 for dynamic_bitset
+	template<size_t Blocks>
+	struct bitset_type
+	{
+		using type = fixed_bitset<Blocks>;
+	};
+
+	template<>
+	struct bitset_type<0>
+	{
+		using type = dynamic_bitset<>;
+	};
+
+	template<size_t Blocks>
+	using bitset_t = typename bitset_type<Blocks>::type;
+
+	// calls the function with the std::integral_constant of the blocks number of the smallest
+	// fixed bitset with at least size bits, 0 above the largest
+	template<typename Function>
+	decltype(auto) dispatch_bitset_width(size_t size, Function&& function) noexcept
+	{
+		if(size <= fixed_bitset<1>::max_size)
+		{
+			return function(std::integral_constant<size_t, 1>());
+		}
+		if(size <= fixed_bitset<4>::max_size)
+		{
+			return function(std::integral_constant<size_t, 4>());
+		}
+		if(size <= fixed_bitset<16>::max_size)
+		{
+			return function(std::integral_constant<size_t, 16>());
+		}
+		return function(std::integral_constant<size_t, 0>());
+	}
+} // namespace uscp
+
+#endif //USCP_FIXED_BITSET_HPP
@@ -40,6 +40,30 @@ private:
 	std::unique_ptr<PermutationsGenerator> m_lower_permutation;
 };
 
+// k-combinations of n elements in revolving door order (Knuth, TAOCP 7.2.1.3, algorithm R):
+// each combination differs from the previous one by a single element removed and a single added
+class RevolvingDoorGenerator
+{
+public:
+	// starts at the combination of rank first_rank
+	RevolvingDoorGenerator(size_t elements_number,
+	                       size_t combination_size,
+	                       size_t first_rank = 0) noexcept;
+
+	// elements of the current combination, in increasing order
+	[[nodiscard]] const std::vector<size_t>& combination() const noexcept;
+
+	// false if the current combination was the last one
+	bool next(size_t& removed, size_t& added) noexcept;
+
+private:
+	const size_t m_elements_number;
+	std::vector<size_t> m_combination;
+};
+
+// binomial coefficient, saturated to the maximum size_t
+[[nodiscard]] size_t binomial(size_t n, size_t k) noexcept;
+
 void increment(dynamic_bitset<>& bitset);
 
 #endif //USCP_PERMUTATIONS_HPP
@@ -0,0 +1,88 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "solver/algorithms/adaptive.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+
+uscp::adaptive::ucb::ucb(size_t arms_number) noexcept: m_arms(arms_number), m_pinned()
+{
+	assert(arms_number > 0);
+}
+
+size_t uscp::adaptive::ucb::select() const noexcept
+{
+	if(m_pinned)
+	{
+		return *m_pinned;
+	}
+	size_t uses = 0;
+	double max_rate = 0;
+	for(size_t arm = 0; arm < m_arms.size(); ++arm)
+	{
+		if(m_arms[arm].uses == 0)
+		{
+			return arm;
+		}
+		uses += m_arms[arm].uses;
+		if(m_arms[arm].time > 0)
+		{
+			max_rate = std::max(max_rate,
+			                    static_cast<double>(m_arms[arm].improvement) / m_arms[arm].time);
+		}
+	}
+
+	// exploration term scaled by the best rate: rewards are not bounded
+	const double scale = max_rate > 0 ? max_rate : 1;
+	const double log_uses = std::log(static_cast<double>(uses));
+	size_t best_arm = 0;
+	double best_bound = 0;
+	for(size_t arm = 0; arm < m_arms.size(); ++arm)
+	{
+		const double rate =
+		  m_arms[arm].time > 0 ? static_cast<double>(m_arms[arm].improvement) / m_arms[arm].time : 0;
+		const double bound =
+		  rate + scale * std::sqrt(2 * log_uses / static_cast<double>(m_arms[arm].uses));
+		if(bound > best_bound)
+		{
+			best_arm = arm;
+			best_bound = bound;
+		}
+	}
+	return best_arm;
+}
+
+void uscp::adaptive::ucb::pin(size_t arm) noexcept
+{
+	assert(arm < m_arms.size());
+	m_pinned = arm;
+}
+
+void uscp::adaptive::ucb::update(size_t arm, size_t improvement, double time) noexcept
+{
+	assert(arm < m_arms.size());
+	++m_arms[arm].uses;
+	m_arms[arm].improvement += improvement;
+	m_arms[arm].time += time;
+}
+
+const std::vector<uscp::adaptive::arm_statistics>& uscp::adaptive::ucb::statistics() const noexcept
+{
+	return m_arms;
+}
+
+bool uscp::adaptive::ucb::load(const std::vector<arm_statistics>& statistics) noexcept
+{
+	if(statistics.size() != m_arms.size())
+	{
+		return false;
+	}
+	m_arms = statistics;
+	return true;
+}
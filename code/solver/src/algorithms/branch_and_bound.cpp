@@ -0,0 +1,373 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "solver/algorithms/branch_and_bound.hpp"
+#include "solver/utils/fixed_bitset.hpp"
+#include "common/utils/timer.hpp"
+
+#include <dynamic_bitset.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <atomic>
+#include <mutex>
+#include <cmath>
+#include <cassert>
+
+namespace
+{
+	// state shared by the searches of the subtrees
+	template<typename points_bitset_t, typename subsets_bitset_t>
+	struct shared_search final
+	{
+		shared_search(const uscp::problem::instance& problem_,
+		              const uscp::branch_and_bound::config& config_,
+		              const dynamic_bitset<>& best_) noexcept
+		  : problem(problem_)
+		  , config(config_)
+		  , points_subsets(problem_.points_number, subsets_bitset_t(problem_.subsets_number))
+		  , subsets_points()
+		  , subsets_points_list(problem_.subsets_number)
+		  , best_mutex()
+		  , best(best_)
+		  , best_size(best_.count())
+		  , nodes(0)
+		  , stopped(false)
+		  , search_timer()
+		{
+			subsets_points.reserve(problem.subsets_number);
+			for(size_t i_subset = 0; i_subset < problem.subsets_number; ++i_subset)
+			{
+				subsets_points.emplace_back(problem.subsets_points[i_subset]);
+				problem.subsets_points[i_subset].iterate_bits_on([&](size_t i_point) noexcept {
+					points_subsets[i_point].set(i_subset);
+					subsets_points_list[i_subset].push_back(i_point);
+				});
+			}
+		}
+
+		const uscp::problem::instance& problem;
+		const uscp::branch_and_bound::config& config;
+		std::vector<subsets_bitset_t> points_subsets;
+		std::vector<points_bitset_t> subsets_points;
+		std::vector<std::vector<size_t>> subsets_points_list;
+		std::mutex best_mutex;
+		dynamic_bitset<> best;
+		std::atomic<size_t> best_size;
+		std::atomic<size_t> nodes;
+		std::atomic<bool> stopped;
+		const timer search_timer;
+	};
+
+	// node of the search tree: selected subsets and subsets still allowed
+	template<typename subsets_bitset_t>
+	struct subtree final
+	{
+		std::vector<size_t> selected;
+		subsets_bitset_t candidates;
+	};
+
+	template<typename points_bitset_t, typename subsets_bitset_t>
+	class search final
+	{
+	public:
+		typedef shared_search<points_bitset_t, subsets_bitset_t> shared_search_t;
+		typedef subtree<subsets_bitset_t> subtree_t;
+
+		explicit search(shared_search_t& shared) noexcept
+		  : m_shared(shared)
+		  , m_problem(shared.problem)
+		  , m_covered(m_problem.subsets_number + 1, points_bitset_t(m_problem.points_number))
+		  , m_candidates(m_problem.subsets_number + 1, subsets_bitset_t(m_problem.subsets_number))
+		  , m_blocked(m_problem.points_number)
+		  , m_point_candidates(m_problem.subsets_number)
+		  , m_selected()
+		  , m_root_depth(0)
+		  , m_children(nullptr)
+		{
+			m_selected.reserve(m_problem.subsets_number);
+		}
+
+		// explore the subtree, or only list its children if children is not null
+		void run(const subtree_t& root, std::vector<subtree_t>* children = nullptr) noexcept
+		{
+			m_selected = root.selected;
+			m_root_depth = m_selected.size();
+			m_children = children;
+			m_covered[m_root_depth].reset();
+			for(size_t i_subset: m_selected)
+			{
+				m_covered[m_root_depth] |= m_shared.subsets_points[i_subset];
+			}
+			m_candidates[m_root_depth] = root.candidates;
+			explore(m_root_depth);
+		}
+
+	private:
+		// a lower bound on the number of subsets to add: points pairwise not covered by a same
+		// candidate subset, also select the point with the fewest candidates to branch on
+		[[nodiscard]] size_t lower_bound(size_t depth, size_t& branching_point) noexcept
+		{
+			const subsets_bitset_t& candidates = m_candidates[depth];
+			m_blocked = m_covered[depth];
+			size_t bound = 0;
+			size_t branching_candidates_number = std::numeric_limits<size_t>::max();
+			branching_point = m_problem.points_number;
+			for(size_t i_point = 0; i_point < m_problem.points_number; ++i_point)
+			{
+				if(m_covered[depth][i_point])
+				{
+					continue;
+				}
+				m_point_candidates = m_shared.points_subsets[i_point];
+				m_point_candidates &= candidates;
+				const size_t candidates_number = m_point_candidates.count();
+				if(candidates_number < branching_candidates_number)
+				{
+					branching_point = i_point;
+					branching_candidates_number = candidates_number;
+					if(candidates_number == 0)
+					{
+						// can't be covered anymore
+						return std::numeric_limits<size_t>::max();
+					}
+				}
+				if(!m_blocked[i_point])
+				{
+					++bound;
+					m_point_candidates.iterate_bits_on([&](size_t i_subset) noexcept {
+						m_blocked |= m_shared.subsets_points[i_subset];
+					});
+				}
+			}
+			return std::max(bound, lagrangian_bound(depth));
+		}
+
+		// Lagrangian relaxation of the remaining problem, valid for any non-negative multipliers:
+		// sum of the multipliers of the uncovered points and of the negative candidates reduced costs
+		[[nodiscard]] size_t lagrangian_bound(size_t depth) const noexcept
+		{
+			const std::vector<double>& multipliers = m_shared.config.multipliers;
+			if(multipliers.empty())
+			{
+				return 0;
+			}
+			assert(multipliers.size() == m_problem.points_number);
+			const points_bitset_t& covered = m_covered[depth];
+			double bound = 0;
+			for(size_t i_point = 0; i_point < m_problem.points_number; ++i_point)
+			{
+				if(!covered[i_point])
+				{
+					bound += multipliers[i_point];
+				}
+			}
+			m_candidates[depth].iterate_bits_on([&](size_t i_subset) noexcept {
+				double reduced_cost = 1;
+				for(size_t i_point: m_shared.subsets_points_list[i_subset])
+				{
+					if(!covered[i_point])
+					{
+						reduced_cost -= multipliers[i_point];
+					}
+				}
+				bound += std::min(reduced_cost, 0.0);
+			});
+			// tolerance for the rounding errors of the sums
+			return bound > 0 ? static_cast<size_t>(std::ceil(bound - 1e-6)) : 0;
+		}
+
+		void explore(size_t depth) noexcept
+		{
+			const size_t nodes = ++m_shared.nodes;
+			if(m_shared.stopped.load(std::memory_order_relaxed) || nodes >= m_shared.config.max_nodes
+			   || (nodes % 1024 == 0 && m_shared.search_timer.elapsed() >= m_shared.config.max_time))
+			{
+				m_shared.stopped = true;
+				return;
+			}
+			if(m_shared.best_size.load(std::memory_order_relaxed) <= m_shared.config.lower_bound)
+			{
+				// optimal solution already found
+				return;
+			}
+
+			if(m_covered[depth].all())
+			{
+				const std::lock_guard<std::mutex> lock(m_shared.best_mutex);
+				if(depth < m_shared.best_size)
+				{
+					m_shared.best.reset();
+					for(size_t i_subset: m_selected)
+					{
+						m_shared.best.set(i_subset);
+					}
+					m_shared.best_size = depth;
+				}
+				return;
+			}
+
+			size_t branching_point = 0;
+			const size_t bound = lower_bound(depth, branching_point);
+			if(bound == std::numeric_limits<size_t>::max() || depth + bound >= m_shared.best_size)
+			{
+				return;
+			}
+			assert(branching_point < m_problem.points_number);
+
+			if(m_children != nullptr && depth > m_root_depth)
+			{
+				m_children->push_back({m_selected, m_candidates[depth]});
+				return;
+			}
+
+			// subsets covering the most uncovered points first
+			std::vector<std::pair<size_t, size_t>> branches; // (uncovered points, subset)
+			m_point_candidates = m_shared.points_subsets[branching_point];
+			m_point_candidates &= m_candidates[depth];
+			m_point_candidates.iterate_bits_on([&](size_t i_subset) noexcept {
+				branches.emplace_back(
+				  (m_shared.subsets_points[i_subset] - m_covered[depth]).count(), i_subset);
+			});
+			std::sort(branches.begin(), branches.end(), std::greater<>());
+
+			// the subsets of the previous branches are excluded from the next ones
+			subsets_bitset_t& next_candidates = m_candidates[depth + 1];
+			next_candidates = m_candidates[depth];
+			for(const auto& [uncovered_points, i_subset]: branches)
+			{
+				(void)uncovered_points;
+				next_candidates.reset(i_subset);
+				m_covered[depth + 1] = m_covered[depth];
+				m_covered[depth + 1] |= m_shared.subsets_points[i_subset];
+				m_selected.push_back(i_subset);
+				explore(depth + 1);
+				m_selected.pop_back();
+				if(m_shared.stopped || depth + bound >= m_shared.best_size)
+				{
+					return;
+				}
+			}
+		}
+
+		shared_search_t& m_shared;
+		const uscp::problem::instance& m_problem;
+		std::vector<points_bitset_t> m_covered;     // per depth
+		std::vector<subsets_bitset_t> m_candidates; // per depth: subsets still allowed
+		points_bitset_t m_blocked;
+		subsets_bitset_t m_point_candidates;
+		std::vector<size_t> m_selected;
+		size_t m_root_depth;
+		std::vector<subtree_t>* m_children;
+	};
+
+	// subtrees per thread: the dynamic scheduling balances the unequal subtrees
+	constexpr size_t SUBTREES_PER_THREAD = 16;
+	constexpr size_t MAX_SPLIT_DEPTH = 8;
+
+	template<typename points_bitset_t, typename subsets_bitset_t>
+	[[nodiscard]] dynamic_bitset<> search_best(const uscp::solution& solution_initial,
+	                                           const uscp::branch_and_bound::config& config,
+	                                           bool& stopped,
+	                                           size_t& nodes,
+	                                           const std::shared_ptr<spdlog::logger>& logger) noexcept
+	{
+		const uscp::problem::instance& problem = solution_initial.problem;
+		shared_search<points_bitset_t, subsets_bitset_t> shared(
+		  problem, config, solution_initial.selected_subsets);
+		std::vector<subtree<subsets_bitset_t>> subtrees{{{}, subsets_bitset_t(problem.subsets_number)}};
+		subtrees.front().candidates.set();
+		if(config.threads > 1)
+		{
+			// split the first levels of the tree until there are enough subtrees for the threads
+			search<points_bitset_t, subsets_bitset_t> splitter(shared);
+			std::vector<subtree<subsets_bitset_t>> children;
+			for(size_t depth = 0; depth < MAX_SPLIT_DEPTH && !subtrees.empty()
+			                      && subtrees.size() < SUBTREES_PER_THREAD * config.threads;
+			    ++depth)
+			{
+				children.clear();
+				for(const subtree<subsets_bitset_t>& root: subtrees)
+				{
+					splitter.run(root, &children);
+				}
+				std::swap(subtrees, children);
+			}
+			SPDLOG_LOGGER_DEBUG(logger,
+			                    "({}) Branch and bound tree split in {} subtrees",
+			                    problem.name,
+			                    subtrees.size());
+		}
+
+#pragma omp parallel default(none) shared(shared, subtrees) num_threads(config.threads) \
+	  if(config.threads > 1 && subtrees.size() > 1)
+		{
+			search<points_bitset_t, subsets_bitset_t> subtree_search(shared);
+#pragma omp for schedule(dynamic)
+			for(/*no size_t for openMP on Windows*/ int i_subtree_int = 0;
+			    i_subtree_int < static_cast<int>(subtrees.size());
+			    ++i_subtree_int)
+			{
+				subtree_search.run(subtrees[static_cast<size_t>(i_subtree_int)]);
+			}
+		}
+
+		stopped = shared.stopped;
+		nodes = shared.nodes;
+		return shared.best;
+	}
+} // namespace
+
+uscp::branch_and_bound::report::report(const uscp::problem::instance& problem) noexcept
+  : solution_final(problem), optimal(false), nodes(0), time(0)
+{
+}
+
+uscp::branch_and_bound::report uscp::branch_and_bound::solve(
+  const uscp::solution& solution_initial,
+  const uscp::branch_and_bound::config& config,
+  std::shared_ptr<spdlog::logger> logger) noexcept
+{
+	const problem::instance& problem = solution_initial.problem;
+	SPDLOG_LOGGER_DEBUG(logger,
+	                    "({}) Start branch and bound from solution with {} subsets",
+	                    problem.name,
+	                    solution_initial.selected_subsets.count());
+	assert(solution_initial.cover_all_points);
+	const timer timer;
+	bool stopped = false;
+	size_t nodes = 0;
+
+	const dynamic_bitset<> best = uscp::dispatch_bitset_width(
+	  problem.points_number, [&](auto points_blocks) noexcept {
+		  return uscp::dispatch_bitset_width(
+		    problem.subsets_number, [&](auto subsets_blocks) noexcept {
+			    return search_best<uscp::bitset_t<decltype(points_blocks)::value>,
+			                       uscp::bitset_t<decltype(subsets_blocks)::value>>(
+			      solution_initial, config, stopped, nodes, logger);
+		    });
+	  });
+
+	report report(problem);
+	report.solution_final.selected_subsets = best;
+	report.solution_final.compute_cover();
+	assert(report.solution_final.cover_all_points);
+	report.optimal = !stopped;
+	report.nodes = nodes;
+	report.time = timer.elapsed();
+	SPDLOG_LOGGER_DEBUG(logger,
+	                    "({}) Branch and bound found {}solution with {} subsets in {} nodes in {}s",
+	                    problem.name,
+	                    report.optimal ? "optimal " : "",
+	                    report.solution_final.selected_subsets.count(),
+	                    report.nodes,
+	                    report.time);
+	return report;
+}
@@ -0,0 +1,194 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "solver/algorithms/core.hpp"
+#include "solver/algorithms/lagrangian.hpp"
+#include "common/utils/timer.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cassert>
+#include <cstddef>
+
+uscp::core::pricing::pricing(const uscp::problem::instance& problem,
+                             std::shared_ptr<spdlog::logger> logger) noexcept
+  : m_problem(problem)
+  , m_subsets_points(problem.subsets_number)
+  , m_points_subsets(problem.points_number)
+  , m_logger(std::move(logger))
+{
+	for(size_t i_subset = 0; i_subset < m_problem.subsets_number; ++i_subset)
+	{
+		m_problem.subsets_points[i_subset].iterate_bits_on([&](size_t i_point) noexcept {
+			m_subsets_points[i_subset].push_back(i_point);
+			m_points_subsets[i_point].push_back(i_subset);
+		});
+	}
+}
+
+uscp::problem::instance uscp::core::pricing::build_core(
+  const std::vector<double>& multipliers,
+  const dynamic_bitset<>& forced_subsets,
+  const uscp::core::config& config) const noexcept
+{
+	assert(multipliers.size() == m_problem.points_number);
+	assert(forced_subsets.size() == m_problem.subsets_number);
+	const timer timer;
+
+	const std::vector<double> costs = lagrangian::reduced_costs(m_subsets_points, multipliers);
+	const auto cheaper = [&](size_t lhs, size_t rhs) noexcept {
+		return costs[lhs] < costs[rhs] || (costs[lhs] == costs[rhs] && lhs < rhs);
+	};
+
+	// keep the cheapest covering subsets of each point, at least one so the core has a solution
+	dynamic_bitset<> core_subsets = forced_subsets;
+	const size_t subsets_per_point = std::max<size_t>(config.subsets_per_point, 1);
+	std::vector<size_t> candidates;
+	for(const std::vector<size_t>& point_subsets: m_points_subsets)
+	{
+		candidates.assign(point_subsets.cbegin(), point_subsets.cend());
+		const size_t kept = std::min(subsets_per_point, candidates.size());
+		std::nth_element(candidates.begin(),
+		                 candidates.begin() + static_cast<std::ptrdiff_t>(kept),
+		                 candidates.end(),
+		                 cheaper);
+		for(size_t i_candidate = 0; i_candidate < kept; ++i_candidate)
+		{
+			core_subsets.set(candidates[i_candidate]);
+		}
+	}
+
+	// non-core subsets as dominated: the core solutions are expanded as reduced ones
+	problem::instance core{problem::reduction_info(&m_problem)};
+	core.name = m_problem.name + " core";
+	core.points_number = m_problem.points_number;
+	core.subsets_number = core_subsets.count();
+	core.reduction->reduction_applied.subsets_dominated = ~core_subsets;
+	core.subsets_points.reserve(core.subsets_number);
+	core_subsets.iterate_bits_on([&](size_t i_subset) noexcept {
+		core.subsets_points.push_back(m_problem.subsets_points[i_subset]);
+	});
+
+	SPDLOG_LOGGER_DEBUG(m_logger,
+	                    "({}) Built core of {}/{} subsets in {}s",
+	                    m_problem.name,
+	                    core.subsets_number,
+	                    m_problem.subsets_number,
+	                    timer.elapsed());
+	return core;
+}
+
+uscp::solution uscp::core::restrict(const uscp::solution& full_solution,
+                                    const uscp::problem::instance& core) noexcept
+{
+	if(!core.reduction.has_value() || core.reduction->parent_instance != &full_solution.problem)
+	{
+		LOGGER->error("Tried to restrict solution to a core of another instance");
+		abort();
+	}
+
+	const dynamic_bitset<>& removed_subsets = core.reduction->reduction_applied.subsets_dominated;
+	solution core_solution(core);
+	size_t i_core = 0;
+	for(size_t i_subset = 0; i_subset < full_solution.problem.subsets_number; ++i_subset)
+	{
+		if(!removed_subsets[i_subset])
+		{
+			core_solution.selected_subsets[i_core++] = full_solution.selected_subsets[i_subset];
+		}
+		else if(full_solution.selected_subsets[i_subset])
+		{
+			LOGGER->error("Tried to restrict solution with subset {} out of the core", i_subset);
+			abort();
+		}
+	}
+	assert(i_core == core.subsets_number);
+	core_solution.compute_cover();
+	return core_solution;
+}
+
+uscp::rwls::report uscp::core::improve(const uscp::solution& solution_initial,
+                                       const std::vector<double>& multipliers_initial,
+                                       uscp::random_engine& generator,
+                                       uscp::rwls::position stopping_criterion,
+                                       const uscp::core::config& config,
+                                       std::shared_ptr<spdlog::logger> logger) noexcept
+{
+	const problem::instance& problem = solution_initial.problem;
+	logger->info("({}) Start optimising by core RWLS solution with {} subsets",
+	             problem.name,
+	             solution_initial.selected_subsets.count());
+	const timer timer;
+	const pricing pricing(problem, logger);
+
+	// pricing warm-started from the previous multipliers: small steps
+	lagrangian::config pricing_config;
+	pricing_config.iterations = config.pricing_iterations;
+	pricing_config.step_factor = 0.1;
+
+	rwls::report report(problem);
+	report.solution_initial = solution_initial;
+	report.solution_final = solution_initial;
+	report.points_weights_initial.assign(problem.points_number, 1);
+	report.points_weights_final = report.points_weights_initial;
+	report.found_at = {0, 0};
+	report.ended_at = {0, 0};
+	report.stopping_criterion = stopping_criterion;
+
+	// points are the same in all the cores: weights are kept between them
+	std::vector<long long> points_weights = report.points_weights_initial;
+	std::vector<double> multipliers = multipliers_initial;
+	while(report.ended_at.steps < stopping_criterion.steps
+	      && timer.elapsed() < stopping_criterion.time
+	      && report.solution_final.selected_subsets.count() > config.lower_bound)
+	{
+		const problem::instance core =
+		  pricing.build_core(multipliers, report.solution_final.selected_subsets, config);
+		rwls::rwls rwls_manager(core, logger);
+		rwls_manager.initialize();
+		rwls_manager.set_lower_bound(config.lower_bound);
+
+		rwls::position round_stopping_criterion;
+		round_stopping_criterion.steps = stopping_criterion.steps - report.ended_at.steps;
+		round_stopping_criterion.time =
+		  std::min(config.pricing_period, stopping_criterion.time - timer.elapsed());
+		const rwls::report round_report =
+		  rwls::expand(rwls_manager.improve(restrict(report.solution_final, core),
+		                                    points_weights,
+		                                    generator,
+		                                    round_stopping_criterion));
+		points_weights = round_report.points_weights_final;
+		if(round_report.solution_final.selected_subsets.count()
+		   < report.solution_final.selected_subsets.count())
+		{
+			report.solution_final = round_report.solution_final;
+			report.points_weights_final = round_report.points_weights_final;
+			report.found_at = report.ended_at + round_report.found_at;
+		}
+		report.ended_at.steps += round_report.ended_at.steps;
+		report.ended_at.time = timer.elapsed();
+
+		// price all the subsets with the multipliers optimized on the core
+		multipliers =
+		  lagrangian::lower_bound(core, std::move(multipliers), pricing_config, NULL_LOGGER)
+		    .multipliers;
+		SPDLOG_LOGGER_DEBUG(logger,
+		                    "({}) Core RWLS solution with {} subsets at step {} in {}s",
+		                    problem.name,
+		                    report.solution_final.selected_subsets.count(),
+		                    report.ended_at.steps,
+		                    report.ended_at.time);
+	}
+
+	logger->info("({}) Core RWLS improved solution from {} subsets to {} subsets in {}s",
+	             problem.name,
+	             report.solution_initial.selected_subsets.count(),
+	             report.solution_final.selected_subsets.count(),
+	             report.ended_at.time);
+	return report;
+}
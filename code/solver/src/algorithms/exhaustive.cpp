@@ -6,10 +6,23 @@
 // https://opensource.org/licenses/MIT
 //
 #include "solver/algorithms/exhaustive.hpp"
+#include "solver/data/instance.hpp"
+#include "solver/data/solution.hpp"
+#include "solver/algorithms/greedy.hpp"
+#include "solver/algorithms/rwls.hpp"
+#include "solver/algorithms/lagrangian.hpp"
+#include "solver/algorithms/branch_and_bound.hpp"
 #include "solver/utils/permutations.hpp"
+#include "common/utils/random.hpp"
 #include "common/utils/logger.hpp"
 #include "common/utils/timer.hpp"
 
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <limits>
 #include <cassert>
 #include <cstddef>
 
@@ -21,20 +34,116 @@ uscp::solution uscp::exhaustive::solve(const uscp::problem::instance& problem)
 	  problem.points_number,
 	  problem.subsets_number);
 	const timer timer;
-	solution current_solution(problem);
 
-	for(size_t bits_on = 0; bits_on <= problem.subsets_number && !current_solution.cover_all_points;
-	    ++bits_on)
+	// points of each subset, sparse
+	std::vector<size_t> subsets_points_begin(problem.subsets_number + 1, 0);
+	std::vector<size_t> subsets_points;
+	for(size_t i_subset = 0; i_subset < problem.subsets_number; ++i_subset)
+	{
+		problem.subsets_points[i_subset].iterate_bits_on(
+		  [&](size_t i_point) noexcept { subsets_points.push_back(i_point); });
+		subsets_points_begin[i_subset + 1] = subsets_points.size();
+	}
+
+	// each combinations size is split in ranges of ranks explored by the threads,
+	// the first cover found in the revolving door order is kept
+	const size_t ranges_per_size = 64 * std::max(std::thread::hardware_concurrency(), 1u);
+	std::vector<size_t> best_combination;
+	bool found = problem.points_number == 0;
+	for(size_t bits_on = 1; bits_on <= problem.subsets_number && !found; ++bits_on)
 	{
-		SPDLOG_LOGGER_DEBUG(LOGGER, "Started trying permutations of {} bits", bits_on);
-		PermutationsGenerator generator(problem.subsets_number, bits_on);
-		while(!generator.finished() && !current_solution.cover_all_points)
+		size_t combinations_number = binomial(problem.subsets_number, bits_on);
+		if(combinations_number == std::numeric_limits<size_t>::max())
 		{
-			current_solution.selected_subsets = generator.next();
-			current_solution.compute_cover();
+			LOGGER->error("Exhaustive search of combinations of {} subsets out of {} is not possible",
+			              bits_on,
+			              problem.subsets_number);
+			abort();
 		}
+		SPDLOG_LOGGER_DEBUG(
+		  LOGGER, "Started trying {} permutations of {} bits", combinations_number, bits_on);
+		size_t ranges_number = std::min(ranges_per_size, combinations_number);
+		std::atomic<size_t> found_range = ranges_number;
+		std::mutex best_mutex;
+#pragma omp parallel for default(none) \
+  shared(problem, subsets_points_begin, subsets_points, bits_on, combinations_number) \
+    shared(ranges_number, found_range, best_mutex, best_combination) schedule(dynamic)
+		for(/*no size_t for openMP on Windows*/ int i_range_int = 0;
+		    i_range_int < static_cast<int>(ranges_number);
+		    ++i_range_int)
+		{
+			const size_t i_range = static_cast<size_t>(i_range_int);
+			const size_t first_rank = i_range * (combinations_number / ranges_number)
+			                          + std::min(i_range, combinations_number % ranges_number);
+			const size_t ranks_number = combinations_number / ranges_number
+			                            + (i_range < combinations_number % ranges_number ? 1 : 0);
+
+			// number of selected subsets covering each point, updated for each change
+			RevolvingDoorGenerator generator(problem.subsets_number, bits_on, first_rank);
+			std::vector<size_t> points_cover_number(problem.points_number, 0);
+			size_t uncovered_points_number = problem.points_number;
+			auto add = [&](size_t i_subset) noexcept {
+				for(size_t i = subsets_points_begin[i_subset]; i < subsets_points_begin[i_subset + 1];
+				    ++i)
+				{
+					if(points_cover_number[subsets_points[i]]++ == 0)
+					{
+						--uncovered_points_number;
+					}
+				}
+			};
+			auto remove = [&](size_t i_subset) noexcept {
+				for(size_t i = subsets_points_begin[i_subset]; i < subsets_points_begin[i_subset + 1];
+				    ++i)
+				{
+					if(--points_cover_number[subsets_points[i]] == 0)
+					{
+						++uncovered_points_number;
+					}
+				}
+			};
+			for(size_t i_subset: generator.combination())
+			{
+				add(i_subset);
+			}
+
+			size_t removed = 0;
+			size_t added = 0;
+			for(size_t i_rank = 0; i_rank < ranks_number; ++i_rank)
+			{
+				// a cover was found in a previous range
+				if(found_range.load(std::memory_order_relaxed) < i_range)
+				{
+					break;
+				}
+				if(uncovered_points_number == 0)
+				{
+					const std::lock_guard<std::mutex> lock(best_mutex);
+					if(i_range < found_range)
+					{
+						found_range = i_range;
+						best_combination = generator.combination();
+					}
+					break;
+				}
+				if(i_rank + 1 < ranks_number)
+				{
+					[[maybe_unused]] const bool has_next = generator.next(removed, added);
+					assert(has_next);
+					remove(removed);
+					add(added);
+				}
+			}
+		}
+		found = found_range < ranges_number;
 	}
 
+	solution current_solution(problem);
+	for(size_t i_subset: best_combination)
+	{
+		current_solution.selected_subsets.set(i_subset);
+	}
+	current_solution.compute_cover();
 	if(!current_solution.cover_all_points)
 	{
 		LOGGER->warn(
@@ -52,8 +161,51 @@ uscp::solution uscp::exhaustive::solve(const uscp::problem::instance& problem)
 
 uscp::solution uscp::exhaustive::solve_ram(const uscp::problem::instance& problem)
 {
-	(void)problem;
-	//TODO
-	assert(false);
-	return uscp::solution(problem::instance());
+	SPDLOG_LOGGER_DEBUG(
+	  LOGGER,
+	  "Started branch and bound for problem instance with {} points and {} subsets",
+	  problem.points_number,
+	  problem.subsets_number);
+	const timer timer;
+
+	// the reductions keep the optimal solutions, RWLS needs them
+	const problem::instance reduced_problem = problem::reduce(problem);
+	if(reduced_problem.points_number == 0)
+	{
+		LOGGER->info("Found optimal solution by reductions in {}s", timer.elapsed());
+		return expand(solution(reduced_problem));
+	}
+
+	// bounds: Lagrangian relaxation at the root, also used at each node with the same multipliers
+	const lagrangian::report lagrangian_report =
+	  lagrangian::lower_bound(reduced_problem, {}, NULL_LOGGER);
+	branch_and_bound::config config;
+	config.lower_bound = lagrangian_report.lower_bound;
+	config.multipliers = lagrangian_report.multipliers;
+	config.threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+	// incumbent: greedy solution improved by RWLS, stopped at the lower bound
+	random_engine generator(0);
+	rwls::rwls rwls(reduced_problem, NULL_LOGGER);
+	rwls.initialize();
+	rwls.set_lower_bound(config.lower_bound);
+	rwls::position stopping_criterion;
+	stopping_criterion.steps = 100 * (reduced_problem.subsets_number + reduced_problem.points_number);
+	const solution solution_initial =
+	  rwls.improve(greedy::solve(reduced_problem, NULL_LOGGER), generator, stopping_criterion)
+	    .solution_final;
+	SPDLOG_LOGGER_DEBUG(LOGGER,
+	                    "Branch and bound from solution with {} subsets, lower bound {}",
+	                    solution_initial.selected_subsets.count(),
+	                    config.lower_bound);
+
+	const branch_and_bound::report report =
+	  branch_and_bound::solve(solution_initial, config, NULL_LOGGER);
+	assert(report.optimal);
+	const solution solution_final = expand(report.solution_final);
+	LOGGER->info("Found optimal solution by branch and bound with {} subsets in {} nodes in {}s",
+	             solution_final.selected_subsets.count(),
+	             report.nodes,
+	             timer.elapsed());
+	return solution_final;
 }
@@ -0,0 +1,259 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "solver/algorithms/grasp.hpp"
+#include "common/utils/logger.hpp"
+#include "common/utils/timer.hpp"
+
+#include <dynamic_bitset.hpp>
+
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <cassert>
+
+namespace
+{
+	// read only, shared by all the constructions of a batch
+	struct grasp_data final
+	{
+		std::vector<std::vector<size_t>> points_subsets;
+		std::vector<size_t> subsets_points_number;
+		size_t max_subset_points_number;
+
+		explicit grasp_data(const uscp::problem::instance& problem) noexcept;
+	};
+
+	grasp_data::grasp_data(const uscp::problem::instance& problem) noexcept
+	  : points_subsets(problem.points_number)
+	  , subsets_points_number(problem.subsets_number, 0)
+	  , max_subset_points_number(0)
+	{
+		for(size_t i_subset = 0; i_subset < problem.subsets_number; ++i_subset)
+		{
+			problem.subsets_points[i_subset].iterate_bits_on([&](size_t i_point) noexcept {
+				points_subsets[i_point].push_back(i_subset);
+			});
+			subsets_points_number[i_subset] = problem.subsets_points[i_subset].count();
+			max_subset_points_number =
+			  std::max(max_subset_points_number, subsets_points_number[i_subset]);
+		}
+	}
+
+	// subsets in buckets by exact gain, a subset moves to the bucket below when its gain
+	// decreases: the restricted candidate list is read from the highest buckets only
+	class gains_buckets final
+	{
+	public:
+		explicit gains_buckets(const grasp_data& data) noexcept
+		  : m_buckets(data.max_subset_points_number + 1)
+		  , m_gains(data.subsets_points_number)
+		  , m_positions(data.subsets_points_number.size())
+		  , m_max_gain(data.max_subset_points_number)
+		  , m_min_gain(1)
+		{
+			for(size_t i_subset = 0; i_subset < m_gains.size(); ++i_subset)
+			{
+				m_positions[i_subset] = m_buckets[m_gains[i_subset]].size();
+				m_buckets[m_gains[i_subset]].push_back(i_subset);
+			}
+		}
+
+		void decrease(size_t subset) noexcept
+		{
+			assert(m_gains[subset] > 0);
+			std::vector<size_t>& bucket = m_buckets[m_gains[subset]];
+			const size_t position = m_positions[subset];
+			bucket[position] = bucket.back();
+			m_positions[bucket.back()] = position;
+			bucket.pop_back();
+
+			--m_gains[subset];
+			m_positions[subset] = m_buckets[m_gains[subset]].size();
+			m_buckets[m_gains[subset]].push_back(subset);
+			if(m_gains[subset] > 0)
+			{
+				m_min_gain = std::min(m_min_gain, m_gains[subset]);
+			}
+		}
+
+		// uniform choice in the restricted candidate list, nothing if no subset has a gain
+		[[nodiscard]] std::optional<size_t> select(uscp::random_engine& generator,
+		                                           const uscp::grasp::config& config) noexcept
+		{
+			while(m_max_gain > 0 && m_buckets[m_max_gain].empty())
+			{
+				--m_max_gain;
+			}
+			if(m_max_gain == 0)
+			{
+				return {};
+			}
+
+			// candidates: the subsets with a gain in [lowest_gain, m_max_gain]
+			size_t lowest_gain = m_max_gain;
+			size_t candidates_number = m_buckets[m_max_gain].size();
+			if(config.candidates_number > 0)
+			{
+				while(candidates_number < config.candidates_number && lowest_gain > 1)
+				{
+					--lowest_gain;
+					candidates_number += m_buckets[lowest_gain].size();
+				}
+				candidates_number = std::min(candidates_number, config.candidates_number);
+			}
+			else
+			{
+				while(m_buckets[m_min_gain].empty())
+				{
+					++m_min_gain;
+				}
+				const double alpha = std::clamp(config.alpha, 0.0, 1.0);
+				const double threshold = static_cast<double>(m_max_gain)
+				                         - alpha * static_cast<double>(m_max_gain - m_min_gain);
+				lowest_gain = std::max(static_cast<size_t>(std::ceil(threshold)), m_min_gain);
+				candidates_number = 0;
+				for(size_t gain = lowest_gain; gain <= m_max_gain; ++gain)
+				{
+					candidates_number += m_buckets[gain].size();
+				}
+			}
+
+			size_t selected = uscp::random_index(generator, candidates_number);
+			for(size_t gain = m_max_gain;; --gain)
+			{
+				if(selected < m_buckets[gain].size())
+				{
+					return m_buckets[gain][selected];
+				}
+				selected -= m_buckets[gain].size();
+			}
+		}
+
+	private:
+		std::vector<std::vector<size_t>> m_buckets;
+		std::vector<size_t> m_gains;
+		std::vector<size_t> m_positions; // position of the subsets in their bucket
+		size_t m_max_gain;               // no subset with a higher gain
+		size_t m_min_gain;               // no subset with a lower positive gain
+	};
+
+	[[nodiscard, gnu::hot]] uscp::solution build(uscp::random_engine& generator,
+	                                             const uscp::problem::instance& problem,
+	                                             const grasp_data& data,
+	                                             const uscp::grasp::config& config,
+	                                             const std::shared_ptr<spdlog::logger>& logger) noexcept
+	{
+		uscp::solution solution(problem);
+
+		// gains kept exact: covering a point decrease the gain of the subsets covering it
+		gains_buckets gains(data);
+		size_t uncovered_points_number = problem.points_number;
+		while(uncovered_points_number > 0)
+		{
+			const std::optional<size_t> selected_subset = gains.select(generator, config);
+			if(!selected_subset)
+			{
+				logger->error("The problem has no solution");
+				abort();
+			}
+
+			assert(!solution.selected_subsets.test(*selected_subset));
+			solution.selected_subsets.set(*selected_subset);
+			solution.hash ^= uscp::solution::subset_hash(*selected_subset);
+			problem.subsets_points[*selected_subset].iterate_bits_on([&](size_t i_point) noexcept {
+				if(solution.covered_points.test(i_point))
+				{
+					return;
+				}
+				solution.covered_points.set(i_point);
+				--uncovered_points_number;
+				for(size_t i_subset: data.points_subsets[i_point])
+				{
+					gains.decrease(i_subset);
+				}
+			});
+		}
+		solution.cover_all_points = true;
+
+		return solution;
+	}
+} // namespace
+
+uscp::solution uscp::grasp::solve(random_engine& generator,
+                                  const problem::instance& problem,
+                                  const config& config,
+                                  std::shared_ptr<spdlog::logger> logger) noexcept
+{
+	SPDLOG_LOGGER_DEBUG(logger, "({}) Start building GRASP solution", problem.name);
+	const timer timer;
+
+	const grasp_data data(problem);
+	solution solution = build(generator, problem, data, config, logger);
+
+	SPDLOG_LOGGER_DEBUG(logger,
+	                    "({}) Built GRASP solution with {} subsets in {}s",
+	                    problem.name,
+	                    solution.selected_subsets.count(),
+	                    timer.elapsed());
+	return solution;
+}
+
+std::vector<uscp::solution> uscp::grasp::solve_batch(random_engine& generator,
+                                                     const problem::instance& problem,
+                                                     size_t solutions_number,
+                                                     const config& config,
+                                                     std::shared_ptr<spdlog::logger> logger) noexcept
+{
+	SPDLOG_LOGGER_DEBUG(
+	  logger, "({}) Start building {} GRASP solutions", problem.name, solutions_number);
+	const timer timer;
+
+	// one stream per solution: the batch doesn't depend on the threads scheduling
+	std::vector<random_engine> generators = split(generator, solutions_number);
+
+	grasp_data data(problem);
+	grasp::config build_config = config;
+	std::vector<solution> solutions(solutions_number, solution(problem));
+	const int threads_number = static_cast<int>(
+	  config.threads > 0 ? config.threads : std::max(std::thread::hardware_concurrency(), 1u));
+#pragma omp parallel for default(none) shared(solutions, generators, data, build_config, logger) \
+  if(solutions_number > 1) num_threads(threads_number)
+	for(/*no size_t for openMP on Windows*/ int i_solution_int = 0;
+	    i_solution_int < static_cast<int>(solutions.size());
+	    ++i_solution_int)
+	{
+		const size_t i_solution = static_cast<size_t>(i_solution_int);
+		solutions[i_solution] = build(
+		  generators[i_solution], solutions[i_solution].problem, data, build_config, logger);
+	}
+
+	SPDLOG_LOGGER_DEBUG(logger,
+	                    "({}) Built {} GRASP solutions in {}s",
+	                    problem.name,
+	                    solutions_number,
+	                    timer.elapsed());
+	return solutions;
+}
+
+uscp::solution uscp::grasp::solve_best(random_engine& generator,
+                                       const problem::instance& problem,
+                                       size_t solutions_number,
+                                       const config& config,
+                                       std::shared_ptr<spdlog::logger> logger) noexcept
+{
+	assert(solutions_number > 0);
+	std::vector<solution> solutions =
+	  solve_batch(generator, problem, solutions_number, config, logger);
+	const auto best = std::min_element(
+	  solutions.cbegin(), solutions.cend(), [](const solution& a, const solution& b) noexcept {
+		  return a.selected_subsets.count() < b.selected_subsets.count();
+	  });
+	return *best;
+}
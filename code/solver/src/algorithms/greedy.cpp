@@ -9,11 +9,18 @@
 #include "common/utils/timer.hpp"
 #include "common/data/instance.hpp"
 #include "solver/data/solution.hpp"
+#include "solver/utils/fixed_bitset.hpp"
 
 #include <dynamic_bitset.hpp>
 
 #include <utility>
 #include <functional>
+#include <optional>
+#include <queue>
+#include <vector>
+#include <numeric>
+#include <type_traits>
+#include <cassert>
 
 #if defined(__GNUC__)
 #	define COND_LIKELY(expr) __builtin_expect(!!(expr), 1)
@@ -35,66 +42,339 @@
 
 namespace
 {
-	template<typename is_greater_t, bool restricted>
-	[[nodiscard, gnu::hot]] uscp::greedy::report solve_report_impl(
-	  const uscp::problem::instance& problem,
-	  [[maybe_unused]] const dynamic_bitset<>& authorized_subsets,
-	  std::shared_ptr<spdlog::logger> logger) noexcept
+	// gains of all the subsets, computed on demand from the dense subsets points, with fixed
+	// bitsets: copies of the subsets points and a mirror of the covered points
+	template<typename points_bitset_t>
+	class dense_gains final
+	{
+		static constexpr bool fixed = !std::is_same_v<points_bitset_t, dynamic_bitset<>>;
+
+	public:
+		explicit dense_gains(const uscp::problem::instance& problem) noexcept
+		  : m_problem(problem)
+		  , m_subsets_points()
+		  , m_covered_points(problem.points_number)
+		  , m_tmp(problem.points_number)
+		{
+			if constexpr(fixed)
+			{
+				m_subsets_points.reserve(problem.subsets_number);
+				for(const dynamic_bitset<>& subset_points: problem.subsets_points)
+				{
+					m_subsets_points.emplace_back(subset_points);
+				}
+			}
+		}
+
+		[[nodiscard]] size_t candidates_number() const noexcept
+		{
+			return m_problem.subsets_number;
+		}
+
+		[[nodiscard]] size_t gain(size_t candidate, const dynamic_bitset<>& covered_points) noexcept
+		{
+			if constexpr(fixed)
+			{
+				return (m_subsets_points[candidate] - m_covered_points).count();
+			}
+			else
+			{
+				m_tmp = m_problem.subsets_points[candidate];
+				m_tmp -= covered_points;
+				return m_tmp.count();
+			}
+		}
+
+		void add(size_t candidate, uscp::solution& solution) noexcept
+		{
+			solution.selected_subsets.set(candidate);
+			solution.hash ^= uscp::solution::subset_hash(candidate);
+			solution.covered_points |= m_problem.subsets_points[candidate];
+			if constexpr(fixed)
+			{
+				m_covered_points |= m_subsets_points[candidate];
+			}
+		}
+
+	private:
+		const uscp::problem::instance& m_problem;
+		std::vector<points_bitset_t> m_subsets_points; // fixed bitsets only
+		points_bitset_t m_covered_points;              // fixed bitsets only
+		dynamic_bitset<> m_tmp;
+	};
+
+	// exact gains of the authorized subsets only, updated from a sparse index when points are
+	// covered: the cost scale with the size of the subproblem
+	class sparse_gains final
+	{
+	public:
+		sparse_gains(const uscp::problem::instance& problem,
+		             const dynamic_bitset<>& authorized_subsets) noexcept
+		  : m_subsets()
+		  , m_subsets_points_begin()
+		  , m_subsets_points()
+		  , m_points_subsets_begin(problem.points_number + 1, 0)
+		  , m_points_subsets()
+		  , m_gains()
+		{
+			m_subsets.reserve(authorized_subsets.count());
+			m_subsets_points_begin.reserve(m_subsets.capacity() + 1);
+			m_subsets_points_begin.push_back(0);
+			authorized_subsets.iterate_bits_on([&](size_t subset) noexcept {
+				m_subsets.push_back(subset);
+				problem.subsets_points[subset].iterate_bits_on([&](size_t point) noexcept {
+					m_subsets_points.push_back(point);
+					++m_points_subsets_begin[point + 1];
+				});
+				m_subsets_points_begin.push_back(m_subsets_points.size());
+			});
+			std::partial_sum(m_points_subsets_begin.cbegin(),
+			                 m_points_subsets_begin.cend(),
+			                 m_points_subsets_begin.begin());
+
+			// candidates covering each point, in increasing order
+			m_points_subsets.resize(m_subsets_points.size());
+			std::vector<size_t> points_subsets_end(m_points_subsets_begin.cbegin(),
+			                                       m_points_subsets_begin.cend() - 1);
+			m_gains.resize(m_subsets.size());
+			for(size_t candidate = 0; candidate < m_subsets.size(); ++candidate)
+			{
+				for(size_t i = m_subsets_points_begin[candidate];
+				    i < m_subsets_points_begin[candidate + 1];
+				    ++i)
+				{
+					m_points_subsets[points_subsets_end[m_subsets_points[i]]++] = candidate;
+				}
+				m_gains[candidate] =
+				  m_subsets_points_begin[candidate + 1] - m_subsets_points_begin[candidate];
+			}
+		}
+
+		[[nodiscard]] size_t candidates_number() const noexcept
+		{
+			return m_subsets.size();
+		}
+
+		[[nodiscard]] size_t gain(size_t candidate,
+		                          [[maybe_unused]] const dynamic_bitset<>& covered_points) const
+		  noexcept
+		{
+			return m_gains[candidate];
+		}
+
+		void add(size_t candidate, uscp::solution& solution) noexcept
+		{
+			solution.selected_subsets.set(m_subsets[candidate]);
+			solution.hash ^= uscp::solution::subset_hash(m_subsets[candidate]);
+			for(size_t i = m_subsets_points_begin[candidate];
+			    i < m_subsets_points_begin[candidate + 1];
+			    ++i)
+			{
+				const size_t point = m_subsets_points[i];
+				if(solution.covered_points.test(point))
+				{
+					continue;
+				}
+				solution.covered_points.set(point);
+				for(size_t j = m_points_subsets_begin[point]; j < m_points_subsets_begin[point + 1];
+				    ++j)
+				{
+					assert(m_gains[m_points_subsets[j]] > 0);
+					--m_gains[m_points_subsets[j]];
+				}
+			}
+		}
+
+	private:
+		std::vector<size_t> m_subsets; // candidate -> subset, in increasing order
+		std::vector<size_t> m_subsets_points_begin;
+		std::vector<size_t> m_subsets_points;
+		std::vector<size_t> m_points_subsets_begin;
+		std::vector<size_t> m_points_subsets;
+		std::vector<size_t> m_gains;
+	};
+
+	template<bool restricted, typename points_bitset_t>
+	[[nodiscard]] auto make_gains(const uscp::problem::instance& problem,
+	                              [[maybe_unused]] const dynamic_bitset<>& authorized_subsets) noexcept
 	{
-		const is_greater_t is_greater;
 		if constexpr(restricted)
 		{
 			assert(authorized_subsets.size() == problem.subsets_number);
+			return sparse_gains(problem, authorized_subsets);
 		}
-		SPDLOG_LOGGER_DEBUG(logger, "({}) Start building greedy solution", problem.name);
-		const timer timer;
+		else
+		{
+			return dense_gains<points_bitset_t>(problem);
+		}
+	}
 
-		uscp::greedy::report report(problem);
-		while(!report.solution_final.cover_all_points)
+	struct candidate_gain final
+	{
+		size_t gain; // upper bound of the number of points newly covered by the candidate
+		size_t candidate;
+	};
+
+	// candidates are ordered as the subsets, ties are broken on the subsets order
+	template<bool ties_to_last>
+	struct candidate_gain_less final
+	{
+		bool operator()(const candidate_gain& a, const candidate_gain& b) const noexcept
 		{
-			size_t max_subset_number =
-			  report.solution_final.selected_subsets.size(); //invalid initial value
-			dynamic_bitset<> covered_points_with_max_subset(problem.points_number);
-			size_t covered_points_number_with_max_subset =
-			  report.solution_final.covered_points.count();
-			dynamic_bitset<> new_covered_points;
-			for(size_t i = 0; i < problem.subsets_number; ++i)
+			if(a.gain != b.gain)
+			{
+				return a.gain < b.gain;
+			}
+			if constexpr(ties_to_last)
+			{
+				return a.candidate < b.candidate;
+			}
+			else
 			{
-				if constexpr(restricted)
+				return a.candidate > b.candidate;
+			}
+		}
+	};
+
+	// lazy greedy: gains only decrease when points are covered, so heap keys are upper bounds
+	// and only the top of the heap needs to be re-evaluated
+	template<bool ties_to_last, typename gains_t>
+	class lazy_gains final
+	{
+	public:
+		lazy_gains(gains_t& gains, const dynamic_bitset<>& covered_points) noexcept
+		  : m_gains(gains), m_heap(), m_stale()
+		{
+			std::vector<candidate_gain> initial_gains;
+			initial_gains.reserve(gains.candidates_number());
+			for(size_t candidate = 0; candidate < gains.candidates_number(); ++candidate)
+			{
+				const size_t gain = gains.gain(candidate, covered_points);
+				if(gain > 0)
 				{
-					if(!authorized_subsets.test(i))
-					{
-						continue;
-					}
+					initial_gains.push_back({gain, candidate});
 				}
-				if(report.solution_final.selected_subsets[i])
+			}
+			m_heap = heap_t(candidate_gain_less<ties_to_last>(), std::move(initial_gains));
+		}
+
+		// top candidate with its exact gain, invalidate other keys only by decreasing them
+		[[nodiscard]] std::optional<candidate_gain> top(
+		  const dynamic_bitset<>& covered_points) noexcept
+		{
+			while(!m_heap.empty())
+			{
+				candidate_gain current = m_heap.top();
+				const size_t exact_gain = m_gains.gain(current.candidate, covered_points);
+				if(exact_gain == current.gain)
 				{
-					// already selected
-					continue;
+					return current;
+				}
+				m_heap.pop();
+				if(exact_gain > 0)
+				{
+					current.gain = exact_gain;
+					m_heap.push(current);
 				}
+			}
+			return {};
+		}
 
-				new_covered_points = report.solution_final.covered_points;
-				new_covered_points |= problem.subsets_points[i];
-				const size_t new_covered_points_number = new_covered_points.count();
-				if(is_greater(new_covered_points_number, covered_points_number_with_max_subset))
+		// all candidates with the maximum gain, in heap order, removed from the heap
+		void pop_all_top(const dynamic_bitset<>& covered_points,
+		                 std::vector<candidate_gain>& candidates) noexcept
+		{
+			candidates.clear();
+			const std::optional<candidate_gain> first = top(covered_points);
+			if(!first)
+			{
+				return;
+			}
+			m_stale.clear();
+			while(!m_heap.empty() && m_heap.top().gain == first->gain)
+			{
+				candidate_gain current = m_heap.top();
+				m_heap.pop();
+				current.gain = m_gains.gain(current.candidate, covered_points);
+				if(current.gain == first->gain)
+				{
+					candidates.push_back(current);
+				}
+				else if(current.gain > 0)
 				{
-					max_subset_number = i;
-					covered_points_with_max_subset = new_covered_points;
-					covered_points_number_with_max_subset = new_covered_points_number;
+					m_stale.push_back(current);
 				}
 			}
+			for(const candidate_gain& candidate: m_stale)
+			{
+				m_heap.push(candidate);
+			}
+		}
+
+		void pop() noexcept
+		{
+			m_heap.pop();
+		}
+
+		void push(const candidate_gain& candidate) noexcept
+		{
+			m_heap.push(candidate);
+		}
+
+	private:
+		typedef std::priority_queue<candidate_gain,
+		                            std::vector<candidate_gain>,
+		                            candidate_gain_less<ties_to_last>>
+		  heap_t;
+
+		gains_t& m_gains;
+		heap_t m_heap;
+		std::vector<candidate_gain> m_stale;
+	};
+
+	template<typename gains_t>
+	void add_candidate(uscp::solution& solution,
+	                   gains_t& gains,
+	                   const candidate_gain& candidate,
+	                   size_t& uncovered_points_number) noexcept
+	{
+		assert(candidate.gain <= uncovered_points_number);
+		gains.add(candidate.candidate, solution);
+		uncovered_points_number -= candidate.gain;
+		solution.cover_all_points = (uncovered_points_number == 0);
+	}
+
+	template<typename is_greater_t, bool restricted, typename points_bitset_t = dynamic_bitset<>>
+	[[nodiscard, gnu::hot]] uscp::greedy::report solve_report_impl(
+	  const uscp::problem::instance& problem,
+	  [[maybe_unused]] const dynamic_bitset<>& authorized_subsets,
+	  std::shared_ptr<spdlog::logger> logger) noexcept
+	{
+		// std::greater keep the first subset with the maximum gain, std::greater_equal the last one
+		constexpr bool ties_to_last = is_greater_t{}(size_t(0), size_t(0));
+		SPDLOG_LOGGER_DEBUG(logger, "({}) Start building greedy solution", problem.name);
+		const timer timer;
+
+		uscp::greedy::report report(problem);
+		auto gains = make_gains<restricted, points_bitset_t>(problem, authorized_subsets);
+		lazy_gains<ties_to_last, decltype(gains)> heap(gains, report.solution_final.covered_points);
+		size_t uncovered_points_number = problem.points_number;
+		report.solution_final.cover_all_points = (uncovered_points_number == 0);
+		while(!report.solution_final.cover_all_points)
+		{
+			const std::optional<candidate_gain> max_candidate =
+			  heap.top(report.solution_final.covered_points);
 
 			// all subset already included or no subset add covered points
-			if(max_subset_number == report.solution_final.selected_subsets.size())
+			if(!max_candidate)
 			{
 				logger->error("The problem has no solution");
 				abort();
 			}
+			heap.pop();
 
 			// update solution (faster)
-			report.solution_final.selected_subsets[max_subset_number].set();
-			report.solution_final.covered_points = covered_points_with_max_subset;
-			report.solution_final.cover_all_points = report.solution_final.covered_points.all();
+			add_candidate(report.solution_final, gains, *max_candidate, uncovered_points_number);
 
 			// update solution (slower)
 			//solution.compute_cover();
@@ -113,78 +393,46 @@ namespace
 		return report;
 	}
 
-	template<bool restricted>
+	template<bool restricted, typename points_bitset_t = dynamic_bitset<>>
 	[[nodiscard, gnu::hot]] uscp::greedy::report random_solve_report_impl(
 	  uscp::random_engine& generator,
 	  const uscp::problem::instance& problem,
 	  [[maybe_unused]] const dynamic_bitset<>& authorized_subsets,
 	  std::shared_ptr<spdlog::logger> logger) noexcept
 	{
-		if constexpr(restricted)
-		{
-			assert(authorized_subsets.size() == problem.subsets_number);
-		}
 		SPDLOG_LOGGER_DEBUG(logger, "({}) Start building random greedy solution", problem.name);
 		const timer timer;
 
 		uscp::greedy::report report(problem);
-		size_t equal_counter = 0;
-		std::uniform_real_distribution<> dist(0.0, 1.0);
+		auto gains = make_gains<restricted, points_bitset_t>(problem, authorized_subsets);
+		lazy_gains<false, decltype(gains)> heap(gains, report.solution_final.covered_points);
+		std::vector<candidate_gain> max_candidates;
+		size_t uncovered_points_number = problem.points_number;
+		report.solution_final.cover_all_points = (uncovered_points_number == 0);
 		while(!report.solution_final.cover_all_points)
 		{
-			size_t max_subset_number =
-			  report.solution_final.selected_subsets.size(); //invalid initial value
-			dynamic_bitset<> covered_points_with_max_subset(problem.points_number);
-			size_t covered_points_number_with_max_subset =
-			  report.solution_final.covered_points.count();
-			dynamic_bitset<> new_covered_points;
-			for(size_t i = 0; i < problem.subsets_number; ++i)
-			{
-				if constexpr(restricted)
-				{
-					if(!authorized_subsets.test(i))
-					{
-						continue;
-					}
-				}
-				if(report.solution_final.selected_subsets[i])
-				{
-					// already selected
-					continue;
-				}
-
-				new_covered_points = report.solution_final.covered_points;
-				new_covered_points |= problem.subsets_points[i];
-				const size_t new_covered_points_number = new_covered_points.count();
-				if(new_covered_points_number > covered_points_number_with_max_subset)
-				{
-					max_subset_number = i;
-					covered_points_with_max_subset = new_covered_points;
-					covered_points_number_with_max_subset = new_covered_points_number;
-					equal_counter = 1;
-				}
-				else if(new_covered_points_number == covered_points_number_with_max_subset)
-				{
-					++equal_counter;
-					if(dist(generator) < (1.0 / equal_counter))
-					{
-						max_subset_number = i;
-						covered_points_with_max_subset = new_covered_points;
-					}
-				}
-			}
+			heap.pop_all_top(report.solution_final.covered_points, max_candidates);
 
 			// all subset already included or no subset add covered points
-			if(max_subset_number == report.solution_final.selected_subsets.size())
+			if(max_candidates.empty())
 			{
 				logger->error("The problem has no solution");
 				abort();
 			}
 
+			// uniform choice between the subsets with the maximum gain
+			const size_t selected = uscp::random_index(generator, max_candidates.size());
+			for(size_t i = 0; i < max_candidates.size(); ++i)
+			{
+				if(i != selected)
+				{
+					heap.push(max_candidates[i]);
+				}
+			}
+
 			// update solution (faster)
-			report.solution_final.selected_subsets[max_subset_number].set();
-			report.solution_final.covered_points = covered_points_with_max_subset;
-			report.solution_final.cover_all_points = report.solution_final.covered_points.all();
+			add_candidate(
+			  report.solution_final, gains, max_candidates[selected], uncovered_points_number);
 
 			// update solution (slower)
 			//solution.compute_cover();
@@ -238,7 +486,10 @@ uscp::solution uscp::greedy::solve(const uscp::problem::instance& problem,
 uscp::greedy::report uscp::greedy::solve_report(const uscp::problem::instance& problem,
                                                 std::shared_ptr<spdlog::logger> logger) noexcept
 {
-	return solve_report_impl<std::greater<>, false>(problem, dynamic_bitset<>{}, std::move(logger));
+	return uscp::dispatch_bitset_width(problem.points_number, [&](auto points_blocks) noexcept {
+		return solve_report_impl<std::greater<>, false, bitset_t<decltype(points_blocks)::value>>(
+		  problem, dynamic_bitset<>{}, std::move(logger));
+	});
 }
 
 uscp::solution uscp::greedy::rsolve(const uscp::problem::instance& problem,
@@ -250,8 +501,12 @@ uscp::solution uscp::greedy::rsolve(const uscp::problem::instance& problem,
 uscp::greedy::report uscp::greedy::rsolve_report(const uscp::problem::instance& problem,
                                                  std::shared_ptr<spdlog::logger> logger) noexcept
 {
-	return solve_report_impl<std::greater_equal<>, false>(
-	  problem, dynamic_bitset<>{}, std::move(logger));
+	return uscp::dispatch_bitset_width(problem.points_number, [&](auto points_blocks) noexcept {
+		return solve_report_impl<std::greater_equal<>,
+		                         false,
+		                         bitset_t<decltype(points_blocks)::value>>(
+		  problem, dynamic_bitset<>{}, std::move(logger));
+	});
 }
 
 uscp::solution uscp::greedy::random_solve(uscp::random_engine& generator,
@@ -266,8 +521,10 @@ uscp::greedy::report uscp::greedy::random_solve_report(
   const uscp::problem::instance& problem,
   std::shared_ptr<spdlog::logger> logger) noexcept
 {
-	return random_solve_report_impl<false>(
-	  generator, problem, dynamic_bitset<>{}, std::move(logger));
+	return uscp::dispatch_bitset_width(problem.points_number, [&](auto points_blocks) noexcept {
+		return random_solve_report_impl<false, bitset_t<decltype(points_blocks)::value>>(
+		  generator, problem, dynamic_bitset<>{}, std::move(logger));
+	});
 }
 
 uscp::solution uscp::greedy::restricted_solve(const uscp::problem::instance& problem,
@@ -0,0 +1,164 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "solver/algorithms/lagrangian.hpp"
+#include "solver/algorithms/greedy.hpp"
+#include "common/utils/timer.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+
+namespace
+{
+	// tolerance of the floating point sums, the bound is rounded up
+	constexpr double EPSILON = 1e-6;
+} // namespace
+
+uscp::lagrangian::report uscp::lagrangian::lower_bound(const uscp::problem::instance& problem,
+                                                       const uscp::lagrangian::config& config,
+                                                       std::shared_ptr<spdlog::logger> logger) noexcept
+{
+	// multipliers of the covering constraints, initialized with the lowest cost per point
+	std::vector<size_t> points_max_subset_size(problem.points_number, 0);
+	for(size_t i_subset = 0; i_subset < problem.subsets_number; ++i_subset)
+	{
+		const size_t subset_size = problem.subsets_points[i_subset].count();
+		problem.subsets_points[i_subset].iterate_bits_on([&](size_t i_point) noexcept {
+			points_max_subset_size[i_point] = std::max(points_max_subset_size[i_point], subset_size);
+		});
+	}
+	std::vector<double> multipliers(problem.points_number);
+	for(size_t i_point = 0; i_point < problem.points_number; ++i_point)
+	{
+		assert(points_max_subset_size[i_point] > 0);
+		multipliers[i_point] = 1.0 / static_cast<double>(points_max_subset_size[i_point]);
+	}
+
+	return lower_bound(problem, std::move(multipliers), config, std::move(logger));
+}
+
+uscp::lagrangian::report uscp::lagrangian::lower_bound(const uscp::problem::instance& problem,
+                                                       std::vector<double> multipliers,
+                                                       const uscp::lagrangian::config& config,
+                                                       std::shared_ptr<spdlog::logger> logger) noexcept
+{
+	assert(multipliers.size() == problem.points_number);
+	logger->info("({}) Start computing Lagrangian lower bound", problem.name);
+	const timer timer;
+
+	report report;
+	report.upper_bound = uscp::greedy::solve(problem, NULL_LOGGER).selected_subsets.count();
+	report.multipliers = multipliers;
+
+	std::vector<std::vector<size_t>> subsets_points(problem.subsets_number);
+	for(size_t i_subset = 0; i_subset < problem.subsets_number; ++i_subset)
+	{
+		problem.subsets_points[i_subset].iterate_bits_on(
+		  [&](size_t i_point) noexcept { subsets_points[i_subset].push_back(i_point); });
+	}
+
+	// L(u) = sum(u_i) + sum_j(min(0, 1 - sum(u_i, i in S_j))), lower bound for any u >= 0
+	// subgradient: g_i = 1 - |{j in relaxed solution, i in S_j}|
+	std::vector<double> subgradient(problem.points_number);
+	const double upper_bound = static_cast<double>(report.upper_bound);
+	double step_factor = config.step_factor;
+	size_t iterations_without_improvement = 0;
+	double best_bound = 0;
+	while(report.iterations < config.iterations && step_factor >= config.step_factor_min)
+	{
+		++report.iterations;
+		double bound = 0;
+		for(size_t i_point = 0; i_point < problem.points_number; ++i_point)
+		{
+			bound += multipliers[i_point];
+			subgradient[i_point] = 1;
+		}
+		for(const std::vector<size_t>& subset_points: subsets_points)
+		{
+			double reduced_cost = 1;
+			for(size_t i_point: subset_points)
+			{
+				reduced_cost -= multipliers[i_point];
+			}
+			if(reduced_cost < 0)
+			{
+				bound += reduced_cost;
+				for(size_t i_point: subset_points)
+				{
+					subgradient[i_point] -= 1;
+				}
+			}
+		}
+
+		if(bound > best_bound + EPSILON)
+		{
+			best_bound = bound;
+			report.multipliers = multipliers;
+			iterations_without_improvement = 0;
+		}
+		else if(++iterations_without_improvement >= config.step_halving_period)
+		{
+			step_factor /= 2;
+			iterations_without_improvement = 0;
+		}
+		if(std::ceil(best_bound - EPSILON) >= upper_bound)
+		{
+			// the greedy solution is optimal
+			break;
+		}
+
+		// multipliers already at 0 can't decrease: not part of the step direction
+		double subgradient_norm = 0;
+		for(size_t i_point = 0; i_point < problem.points_number; ++i_point)
+		{
+			if(multipliers[i_point] <= 0 && subgradient[i_point] < 0)
+			{
+				subgradient[i_point] = 0;
+			}
+			subgradient_norm += subgradient[i_point] * subgradient[i_point];
+		}
+		if(subgradient_norm <= 0)
+		{
+			// relaxed solution feasible and complementary: optimal multipliers
+			break;
+		}
+
+		const double step = step_factor * (upper_bound - bound) / subgradient_norm;
+		for(size_t i_point = 0; i_point < problem.points_number; ++i_point)
+		{
+			multipliers[i_point] = std::max(0.0, multipliers[i_point] + step * subgradient[i_point]);
+		}
+	}
+
+	report.lagrangian_bound = best_bound;
+	report.lower_bound = static_cast<size_t>(std::max(0.0, std::ceil(best_bound - EPSILON)));
+	report.time = timer.elapsed();
+	logger->info("({}) Computed Lagrangian lower bound {} ({}) in {} iterations and {}s",
+	             problem.name,
+	             report.lower_bound,
+	             report.lagrangian_bound,
+	             report.iterations,
+	             report.time);
+	return report;
+}
+
+std::vector<double> uscp::lagrangian::reduced_costs(
+  const std::vector<std::vector<size_t>>& subsets_points,
+  const std::vector<double>& multipliers) noexcept
+{
+	std::vector<double> costs(subsets_points.size(), 1);
+	for(size_t i_subset = 0; i_subset < subsets_points.size(); ++i_subset)
+	{
+		for(size_t i_point: subsets_points[i_subset])
+		{
+			costs[i_subset] -= multipliers[i_point];
+		}
+	}
+	return costs;
+}
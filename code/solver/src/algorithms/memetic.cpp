@@ -8,6 +8,12 @@
 #include "solver/algorithms/memetic.hpp"
 #include "solver/data/solution.hpp"
 #include "common/utils/logger.hpp"
+#include "solver/utils/binary.hpp"
+
+#include <memory>
+#include <atomic>
+#include <algorithm>
+#include <cassert>
 
 uscp::memetic::position_serial uscp::memetic::position::serialize() const noexcept
 {
@@ -35,6 +41,11 @@ uscp::memetic::config_serial uscp::memetic::config::serialize() const noexcept
 	config_serial serial;
 	serial.stopping_criterion = stopping_criterion.serialize();
 	serial.rwls_stopping_criterion = rwls_stopping_criterion.serialize();
+	serial.population_size = population_size;
+	serial.islands_number = islands_number;
+	serial.migration_interval = migration_interval;
+	serial.steady_state = steady_state;
+	serial.lower_bound = lower_bound;
 	return serial;
 }
 
@@ -50,11 +61,86 @@ bool uscp::memetic::config::load(const uscp::memetic::config_serial& serial) noe
 		LOGGER->warn("Failed to load rwls stopping criterion");
 		return false;
 	}
+	population_size = serial.population_size;
+	islands_number = serial.islands_number;
+	migration_interval = serial.migration_interval;
+	steady_state = serial.steady_state;
+	lower_bound = serial.lower_bound;
+	return true;
+}
+
+uscp::memetic::operator_statistics_serial uscp::memetic::operator_statistics::serialize() const
+  noexcept
+{
+	operator_statistics_serial serial;
+	serial.name = name;
+	serial.uses = statistics.uses;
+	serial.improvement = statistics.improvement;
+	serial.time = statistics.time;
+	return serial;
+}
+
+bool uscp::memetic::operator_statistics::load(
+  const uscp::memetic::operator_statistics_serial& serial) noexcept
+{
+	name = serial.name;
+	statistics.uses = serial.uses;
+	statistics.improvement = serial.improvement;
+	statistics.time = serial.time;
+	return true;
+}
+
+double uscp::memetic::phases_time::total() const noexcept
+{
+	return rwls + crossover + wcrossover + restarts + logging + other;
+}
+
+uscp::memetic::phases_time& uscp::memetic::phases_time::operator+=(
+  const uscp::memetic::phases_time& phases) noexcept
+{
+	rwls += phases.rwls;
+	crossover += phases.crossover;
+	wcrossover += phases.wcrossover;
+	restarts += phases.restarts;
+	logging += phases.logging;
+	other += phases.other;
+	return *this;
+}
+
+uscp::memetic::phases_time_serial uscp::memetic::phases_time::serialize() const noexcept
+{
+	phases_time_serial serial;
+	serial.rwls = rwls;
+	serial.crossover = crossover;
+	serial.wcrossover = wcrossover;
+	serial.restarts = restarts;
+	serial.logging = logging;
+	serial.other = other;
+	return serial;
+}
+
+bool uscp::memetic::phases_time::load(const uscp::memetic::phases_time_serial& serial) noexcept
+{
+	rwls = serial.rwls;
+	crossover = serial.crossover;
+	wcrossover = serial.wcrossover;
+	restarts = serial.restarts;
+	logging = serial.logging;
+	other = serial.other;
 	return true;
 }
 
 uscp::memetic::report::report(const uscp::problem::instance& problem) noexcept
-  : solution_final(problem), found_at(), solve_config(), crossover_operator()
+  : solution_final(problem)
+  , found_at()
+  , solve_config()
+  , crossover_operator()
+  , wcrossover_operator()
+  , found_by_island(0)
+  , crossovers_statistics()
+  , wcrossovers_statistics()
+  , phases()
+  , generations_phases()
 {
 }
 
@@ -68,6 +154,20 @@ uscp::memetic::report_serial uscp::memetic::report::serialize() const noexcept
 	serial.solve_config = solve_config.serialize();
 	serial.crossover_operator = crossover_operator;
 	serial.wcrossover_operator = wcrossover_operator;
+	serial.found_by_island = found_by_island;
+	for(const operator_statistics& statistics: crossovers_statistics)
+	{
+		serial.crossovers_statistics.push_back(statistics.serialize());
+	}
+	for(const operator_statistics& statistics: wcrossovers_statistics)
+	{
+		serial.wcrossovers_statistics.push_back(statistics.serialize());
+	}
+	serial.phases = phases.serialize();
+	for(const phases_time& generation_phases: generations_phases)
+	{
+		serial.generations_phases.push_back(generation_phases.serialize());
+	}
 	return serial;
 }
 
@@ -96,6 +196,39 @@ bool uscp::memetic::report::load(const uscp::memetic::report_serial& serial) noe
 	}
 	crossover_operator = serial.crossover_operator;
 	wcrossover_operator = serial.wcrossover_operator;
+	found_by_island = serial.found_by_island;
+	crossovers_statistics.resize(serial.crossovers_statistics.size());
+	for(size_t i = 0; i < serial.crossovers_statistics.size(); ++i)
+	{
+		if(!crossovers_statistics[i].load(serial.crossovers_statistics[i]))
+		{
+			LOGGER->warn("Failed to load crossovers statistics");
+			return false;
+		}
+	}
+	wcrossovers_statistics.resize(serial.wcrossovers_statistics.size());
+	for(size_t i = 0; i < serial.wcrossovers_statistics.size(); ++i)
+	{
+		if(!wcrossovers_statistics[i].load(serial.wcrossovers_statistics[i]))
+		{
+			LOGGER->warn("Failed to load weights crossovers statistics");
+			return false;
+		}
+	}
+	if(!phases.load(serial.phases))
+	{
+		LOGGER->warn("Failed to load phases time");
+		return false;
+	}
+	generations_phases.resize(serial.generations_phases.size());
+	for(size_t i = 0; i < serial.generations_phases.size(); ++i)
+	{
+		if(!generations_phases[i].load(serial.generations_phases[i]))
+		{
+			LOGGER->warn("Failed to load generations phases time");
+			return false;
+		}
+	}
 	return true;
 }
 
@@ -115,5 +248,233 @@ uscp::memetic::report uscp::memetic::expand(const uscp::memetic::report& reduced
 	expanded_report.solve_config = reduced_report.solve_config;
 	expanded_report.crossover_operator = reduced_report.crossover_operator;
 	expanded_report.wcrossover_operator = reduced_report.wcrossover_operator;
+	expanded_report.found_by_island = reduced_report.found_by_island;
+	expanded_report.crossovers_statistics = reduced_report.crossovers_statistics;
+	expanded_report.wcrossovers_statistics = reduced_report.wcrossovers_statistics;
+	expanded_report.phases = reduced_report.phases;
+	expanded_report.generations_phases = reduced_report.generations_phases;
 	return expanded_report;
 }
+
+uscp::memetic::mailboxes::mailboxes(size_t islands_number) noexcept
+  : m_mailboxes(islands_number), m_stop(false)
+{
+}
+
+void uscp::memetic::mailboxes::post(size_t island, std::shared_ptr<const migrant> migrant) noexcept
+{
+	assert(island < m_mailboxes.size());
+	std::atomic_store(&m_mailboxes[island], std::move(migrant));
+}
+
+std::shared_ptr<const uscp::memetic::migrant> uscp::memetic::mailboxes::read(size_t island) const
+  noexcept
+{
+	assert(island < m_mailboxes.size());
+	return std::atomic_load(&m_mailboxes[island]);
+}
+
+size_t uscp::memetic::mailboxes::islands_number() const noexcept
+{
+	return m_mailboxes.size();
+}
+
+void uscp::memetic::mailboxes::request_stop() noexcept
+{
+	m_stop.store(true, std::memory_order_relaxed);
+}
+
+bool uscp::memetic::mailboxes::stop_requested() const noexcept
+{
+	return m_stop.load(std::memory_order_relaxed);
+}
+
+namespace
+{
+	// file format identifier and version, to refuse incompatible checkpoints
+	constexpr uint64_t CHECKPOINT_MAGIC = 0x5553435043484b34; // "USCPCHK4"
+
+	void write(uscp::binary_writer& writer, const uscp::rwls::position& position) noexcept
+	{
+		writer.write(position.steps);
+		writer.write(position.time);
+	}
+
+	bool read(uscp::binary_reader& reader, uscp::rwls::position& position) noexcept
+	{
+		return reader.read(position.steps) && reader.read(position.time);
+	}
+} // namespace
+
+std::vector<char> uscp::memetic::checkpoint::serialize() const noexcept
+{
+	binary_writer writer;
+	writer.write(CHECKPOINT_MAGIC);
+	writer.write(problem_name);
+	writer.write(points_number);
+	writer.write(subsets_number);
+	writer.write(crossover_operator);
+	writer.write(wcrossover_operator);
+	writer.write(progress);
+	writer.write(generator);
+	writer.write(individuals_generators);
+	writer.write(generation);
+	write(writer, rwls_cumulative_position);
+	writer.write(time);
+	writer.write(rwls_steps);
+	writer.write(dynamic_steps);
+	writer.write(parents_order);
+	writer.write(population);
+	writer.write(population_weights);
+	writer.write(explored);
+	writer.write(solution_best);
+	writer.write(points_weights_best);
+	writer.write(found_at.generation);
+	write(writer, found_at.rwls_cumulative_position);
+	writer.write(found_at.time);
+	writer.write(crossovers_statistics);
+	writer.write(wcrossovers_statistics);
+	writer.write(crossover_selected);
+	writer.write(wcrossover_selected);
+	writer.write(offspring_parents_best);
+	writer.write(offspring_time);
+	writer.write(phases);
+	writer.write(generations_phases);
+	return std::move(writer.data());
+}
+
+bool uscp::memetic::checkpoint::load(const std::vector<char>& data) noexcept
+{
+	binary_reader reader(data);
+	uint64_t magic = 0;
+	if(!reader.read(magic) || magic != CHECKPOINT_MAGIC)
+	{
+		LOGGER->warn("Invalid checkpoint format");
+		return false;
+	}
+	if(!reader.read(problem_name) || !reader.read(points_number) || !reader.read(subsets_number)
+	   || !reader.read(crossover_operator) || !reader.read(wcrossover_operator)
+	   || !reader.read(progress) || !reader.read(generator) || !reader.read(individuals_generators)
+	   || !reader.read(generation) || !read(reader, rwls_cumulative_position)
+	   || !reader.read(time) || !reader.read(rwls_steps) || !reader.read(dynamic_steps)
+	   || !reader.read(parents_order) || !reader.read(population)
+	   || !reader.read(population_weights) || !reader.read(explored) || !reader.read(solution_best)
+	   || !reader.read(points_weights_best) || !reader.read(found_at.generation)
+	   || !read(reader, found_at.rwls_cumulative_position) || !reader.read(found_at.time)
+	   || !reader.read(crossovers_statistics) || !reader.read(wcrossovers_statistics)
+	   || !reader.read(crossover_selected) || !reader.read(wcrossover_selected)
+	   || !reader.read(offspring_parents_best) || !reader.read(offspring_time)
+	   || !reader.read(phases) || !reader.read(generations_phases)
+	   || !reader.finished())
+	{
+		LOGGER->warn("Truncated or corrupted checkpoint");
+		return false;
+	}
+
+	const size_t population_size = population.size();
+	if(population_size < 2 || individuals_generators.size() != population_size
+	   || population_weights.size() != population_size || parents_order.size() != population_size
+	   || offspring_parents_best.size() != population_size
+	   || offspring_time.size() != population_size || dynamic_steps.empty())
+	{
+		LOGGER->warn("Inconsistent checkpoint population");
+		return false;
+	}
+	return true;
+}
+
+bool uscp::memetic::checkpoint::compatible(const uscp::problem::instance& problem,
+                                           std::string_view crossover,
+                                           std::string_view wcrossover) const noexcept
+{
+	if(problem_name != problem.name || points_number != problem.points_number
+	   || subsets_number != problem.subsets_number)
+	{
+		LOGGER->warn("Checkpoint of problem instance {} ({} points, {} subsets) can't be used for "
+		             "problem instance {} ({} points, {} subsets)",
+		             problem_name,
+		             points_number,
+		             subsets_number,
+		             problem.name,
+		             problem.points_number,
+		             problem.subsets_number);
+		return false;
+	}
+	if(crossover_operator != crossover || wcrossover_operator != wcrossover)
+	{
+		LOGGER->warn("Checkpoint of memetic {}/{} can't be used for memetic {}/{}",
+		             crossover_operator,
+		             wcrossover_operator,
+		             crossover,
+		             wcrossover);
+		return false;
+	}
+
+	auto valid_subsets = [&](const std::vector<size_t>& subsets) noexcept {
+		return std::all_of(subsets.cbegin(), subsets.cend(), [&](size_t subset) noexcept {
+			return subset < problem.subsets_number;
+		});
+	};
+	auto valid_weights = [&](const std::vector<long long>& weights) noexcept {
+		return weights.size() == problem.points_number;
+	};
+	if(!std::all_of(population.cbegin(), population.cend(), valid_subsets)
+	   || !std::all_of(population_weights.cbegin(), population_weights.cend(), valid_weights)
+	   || !valid_subsets(solution_best)
+	   || !(points_weights_best.empty() || valid_weights(points_weights_best)))
+	{
+		LOGGER->warn("Checkpoint solutions don't match problem instance {}", problem.name);
+		return false;
+	}
+	return true;
+}
+
+uscp::memetic::recent_solutions::recent_solutions(size_t capacity) noexcept
+  : m_hashes(), m_mask(0)
+{
+	// power of 2 capacity for the slot to be the low bits of the hash
+	size_t slots_number = 1;
+	while(slots_number < capacity)
+	{
+		slots_number *= 2;
+	}
+	m_hashes = std::vector<std::atomic<uint64_t>>(slots_number);
+	for(std::atomic<uint64_t>& hash: m_hashes)
+	{
+		hash.store(0, std::memory_order_relaxed);
+	}
+	m_mask = slots_number - 1;
+}
+
+bool uscp::memetic::recent_solutions::insert(const solution& solution) noexcept
+{
+	const uint64_t hash = solution.hash;
+	return m_hashes[hash & m_mask].exchange(hash, std::memory_order_relaxed) == hash;
+}
+
+std::vector<uint64_t> uscp::memetic::recent_solutions::hashes() const noexcept
+{
+	std::vector<uint64_t> hashes;
+	hashes.reserve(m_hashes.size());
+	for(const std::atomic<uint64_t>& hash: m_hashes)
+	{
+		hashes.push_back(hash.load(std::memory_order_relaxed));
+	}
+	return hashes;
+}
+
+bool uscp::memetic::recent_solutions::load(const std::vector<uint64_t>& hashes) noexcept
+{
+	if(hashes.size() != m_hashes.size())
+	{
+		LOGGER->warn("Tried to load {} recent solutions in a table of {}",
+		             hashes.size(),
+		             m_hashes.size());
+		return false;
+	}
+	for(size_t i = 0; i < hashes.size(); ++i)
+	{
+		m_hashes[i].store(hashes[i], std::memory_order_relaxed);
+	}
+	return true;
+}
@@ -8,6 +8,11 @@
 #include "solver/algorithms/random.hpp"
 #include "common/utils/logger.hpp"
 #include "common/utils/timer.hpp"
+#include "solver/algorithms/redundancy.hpp"
+
+#include <vector>
+#include <numeric>
+#include <cassert>
 
 uscp::solution uscp::random::solve(random_engine& generator,
                                    const problem::instance& problem,
@@ -18,17 +23,17 @@ uscp::solution uscp::random::solve(random_engine& generator,
 	solution solution(problem);
 
 	assert(problem.subsets_number > 0);
-	std::uniform_int_distribution<size_t> dist(0, problem.subsets_number - 1);
 	while(!solution.covered_points.all())
 	{
 		assert(!solution.selected_subsets.all());
-		size_t selected_subset = dist(generator);
+		size_t selected_subset = random_index(generator, problem.subsets_number);
 		while(solution.selected_subsets.test(selected_subset))
 		{
-			selected_subset = dist(generator);
+			selected_subset = random_index(generator, problem.subsets_number);
 		}
 		solution.selected_subsets.set(selected_subset);
 		solution.covered_points |= problem.subsets_points[selected_subset];
+		solution.hash ^= solution::subset_hash(selected_subset);
 	}
 	solution.cover_all_points = true;
 
@@ -50,18 +55,18 @@ uscp::solution uscp::random::restricted_solve(uscp::random_engine& generator,
 	solution solution(problem);
 
 	assert(problem.subsets_number > 0);
-	std::uniform_int_distribution<size_t> dist(0, problem.subsets_number - 1);
 	while(!solution.covered_points.all())
 	{
 		assert(!solution.selected_subsets.all());
-		size_t selected_subset = dist(generator);
+		size_t selected_subset = random_index(generator, problem.subsets_number);
 		while(!authorized_subsets.test(selected_subset)
 		      || solution.selected_subsets.test(selected_subset))
 		{
-			selected_subset = dist(generator);
+			selected_subset = random_index(generator, problem.subsets_number);
 		}
 		solution.selected_subsets.set(selected_subset);
 		solution.covered_points |= problem.subsets_points[selected_subset];
+		solution.hash ^= solution::subset_hash(selected_subset);
 	}
 	solution.cover_all_points = true;
 
@@ -72,3 +77,63 @@ uscp::solution uscp::random::restricted_solve(uscp::random_engine& generator,
 	                    timer.elapsed());
 	return solution;
 }
+
+uscp::solution uscp::random::point_solve(uscp::random_engine& generator,
+                                         const uscp::problem::instance& problem,
+                                         const uscp::subproblem::points_subsets& points_subsets,
+                                         bool remove_redundant,
+                                         std::shared_ptr<spdlog::logger> logger) noexcept
+{
+	SPDLOG_LOGGER_DEBUG(logger, "({}) Start building point random solution", problem.name);
+	const timer timer;
+	solution solution(problem);
+
+	// uncovered points, a covered point is replaced by the last one
+	std::vector<size_t> uncovered_points(problem.points_number);
+	std::iota(std::begin(uncovered_points), std::end(uncovered_points), 0);
+	std::vector<size_t> uncovered_points_position(uncovered_points);
+	std::vector<size_t> selected_subsets; // in the selection order
+	while(!uncovered_points.empty())
+	{
+		const size_t point = uncovered_points[random_index(generator, uncovered_points.size())];
+		const size_t subsets_number = points_subsets.subsets_number(point);
+		if(subsets_number == 0)
+		{
+			logger->error("The problem has no solution");
+			abort();
+		}
+
+		// covers an uncovered point: not already selected
+		const size_t selected_subset =
+		  points_subsets.subset(point, random_index(generator, subsets_number));
+		assert(!solution.selected_subsets.test(selected_subset));
+		selected_subsets.push_back(selected_subset);
+		solution.selected_subsets.set(selected_subset);
+		solution.hash ^= solution::subset_hash(selected_subset);
+		problem.subsets_points[selected_subset].iterate_bits_on([&](size_t i_point) noexcept {
+			if(solution.covered_points.test(i_point))
+			{
+				return;
+			}
+			solution.covered_points.set(i_point);
+			const size_t position = uncovered_points_position[i_point];
+			uncovered_points[position] = uncovered_points.back();
+			uncovered_points_position[uncovered_points.back()] = position;
+			uncovered_points.pop_back();
+		});
+	}
+	solution.cover_all_points = true;
+
+	// first selected subsets first: the most likely to be covered by the next ones
+	if(remove_redundant)
+	{
+		redundancy::remove_ordered(solution, selected_subsets);
+	}
+
+	SPDLOG_LOGGER_DEBUG(logger,
+	                    "({}) Built point random solution with {} subsets in {}s",
+	                    problem.name,
+	                    solution.selected_subsets.count(),
+	                    timer.elapsed());
+	return solution;
+}
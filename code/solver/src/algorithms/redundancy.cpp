@@ -0,0 +1,86 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "solver/algorithms/redundancy.hpp"
+
+#include <dynamic_bitset.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <cassert>
+
+namespace
+{
+	// selected subsets sorted by increasing key, ties broken on the subsets order
+	template<typename Key>
+	[[nodiscard]] std::vector<size_t> sorted_subsets(const uscp::solution& solution,
+	                                                 Key&& key) noexcept
+	{
+		std::vector<std::pair<decltype(key(size_t(0))), size_t>> keyed_subsets;
+		solution.selected_subsets.iterate_bits_on(
+		  [&](size_t i_subset) noexcept { keyed_subsets.emplace_back(key(i_subset), i_subset); });
+		std::sort(keyed_subsets.begin(), keyed_subsets.end());
+
+		std::vector<size_t> subsets_order;
+		subsets_order.reserve(keyed_subsets.size());
+		for(const auto& [subset_key, i_subset]: keyed_subsets)
+		{
+			subsets_order.push_back(i_subset);
+		}
+		return subsets_order;
+	}
+} // namespace
+
+void uscp::redundancy::remove_ordered(uscp::solution& solution,
+                                      const std::vector<size_t>& subsets_order) noexcept
+{
+	const problem::instance& problem = solution.problem;
+
+	// number of selected subsets covering each point
+	std::vector<size_t> points_cover_number(problem.points_number, 0);
+	solution.selected_subsets.iterate_bits_on([&](size_t i_subset) noexcept {
+		problem.subsets_points[i_subset].iterate_bits_on(
+		  [&](size_t i_point) noexcept { ++points_cover_number[i_point]; });
+	});
+
+	for(size_t i_subset: subsets_order)
+	{
+		assert(solution.selected_subsets.test(i_subset));
+		bool redundant = true;
+		problem.subsets_points[i_subset].iterate_bits_on([&](size_t i_point) noexcept {
+			redundant = points_cover_number[i_point] > 1;
+			return redundant;
+		});
+		if(!redundant)
+		{
+			continue;
+		}
+		problem.subsets_points[i_subset].iterate_bits_on(
+		  [&](size_t i_point) noexcept { --points_cover_number[i_point]; });
+		solution.selected_subsets.reset(i_subset);
+		solution.hash ^= solution::subset_hash(i_subset);
+	}
+}
+
+void uscp::redundancy::remove(uscp::solution& solution) noexcept
+{
+	remove_ordered(solution, sorted_subsets(solution, [&](size_t i_subset) noexcept {
+		               return solution.problem.subsets_points[i_subset].count();
+	               }));
+}
+
+void uscp::redundancy::remove_weighted(uscp::solution& solution,
+                                       const std::vector<long long>& points_weights) noexcept
+{
+	assert(points_weights.size() == solution.problem.points_number);
+	remove_ordered(solution, sorted_subsets(solution, [&](size_t i_subset) noexcept {
+		               long long weight = 0;
+		               solution.problem.subsets_points[i_subset].iterate_bits_on(
+		                 [&](size_t i_point) noexcept { weight += points_weights[i_point]; });
+		               return weight;
+	               }));
+}
@@ -7,6 +7,7 @@
 //
 #include "solver/algorithms/rwls.hpp"
 #include "solver/data/solution.hpp"
+#include "solver/algorithms/redundancy.hpp"
 #include "common/utils/timer.hpp"
 #include "common/utils/utils.hpp"
 
@@ -70,6 +71,12 @@ uscp::rwls::report uscp::rwls::rwls::improve_impl(
 	report report(m_problem);
 	report.solution_initial = solution;
 	report.solution_final = solution;
+	if constexpr(!restricted)
+	{
+		// one pass instead of a subset removal with its scores update for each redundant subset,
+		// the restricted search can't remove the subsets not authorized
+		redundancy::remove_weighted(report.solution_final, points_weights_initial);
+	}
 	report.found_at = {0, 0};
 	report.ended_at = {0, 0};
 	report.stopping_criterion = stopping_criterion;
@@ -131,6 +138,12 @@ uscp::rwls::report uscp::rwls::rwls::improve_impl(
 				LOGGER->error("RWLS new best solution doesn't cover all points");
 				abort();
 			}
+			if(data.best_solution.selected_subsets.count() <= m_lower_bound)
+			{
+				m_logger->info("({}) RWLS reached the lower bound: solution is optimal",
+				               m_problem.name);
+				break;
+			}
 		}
 
 		// remove subset
@@ -317,6 +330,7 @@ uscp::rwls::rwls::rwls(const problem::instance& problem,
   , m_subsets_points()
   , m_subsets_covering_points()
   , m_initialized(false)
+  , m_lower_bound(0)
   , m_logger(std::move(logger))
 {
 	m_subsets_points.resize(m_problem.subsets_number);
@@ -336,6 +350,11 @@ void uscp::rwls::rwls::initialize() noexcept
 	m_initialized = true;
 }
 
+void uscp::rwls::rwls::set_lower_bound(size_t lower_bound) noexcept
+{
+	m_lower_bound = lower_bound;
+}
+
 uscp::rwls::report uscp::rwls::rwls::improve(const uscp::solution& solution,
                                              uscp::random_engine& generator,
                                              uscp::rwls::position stopping_criterion) noexcept
@@ -433,6 +452,9 @@ void uscp::rwls::rwls::init(uscp::rwls::rwls::resolution_data& data,
 {
 	assert(points_weights_initial.size() == m_problem.points_number);
 
+	// hash then maintained by add_subset and remove_subset
+	data.current_solution.compute_hash();
+
 	// points information
 	dynamic_bitset<> tmp;
 #pragma omp parallel for default(none) shared(data, points_weights_initial) private(tmp)
@@ -474,6 +496,7 @@ void uscp::rwls::rwls::add_subset(uscp::rwls::rwls::resolution_data& data,
 
 	// add subset to solution
 	data.current_solution.selected_subsets.set(subset_number);
+	data.current_solution.hash ^= solution::subset_hash(subset_number);
 	data.uncovered_points -= m_problem.subsets_points[subset_number];
 
 	// compute new score
@@ -536,6 +559,7 @@ void uscp::rwls::rwls::remove_subset(uscp::rwls::rwls::resolution_data& data,
 
 	// remove subset from solution
 	data.current_solution.selected_subsets.reset(subset_number);
+	data.current_solution.hash ^= solution::subset_hash(subset_number);
 
 	// compute new score
 	const long long new_score = -data.subsets_information[subset_number].score;
@@ -818,11 +842,11 @@ size_t uscp::rwls::rwls::select_uncovered_point(uscp::rwls::rwls::resolution_dat
 {
 	assert(data.uncovered_points.count() > 0);
 	size_t selected_point = 0;
-	std::uniform_int_distribution<size_t> uncovered_point_dist(0, data.uncovered_points.count());
-	const size_t selected_point_number = uncovered_point_dist(data.generator);
+	const size_t selected_point_number =
+	  uscp::random_index(data.generator, data.uncovered_points.count());
 	size_t current_point_number = 0;
 	data.uncovered_points.iterate_bits_on([&](size_t bit_on) noexcept {
-		if(++current_point_number >= selected_point_number)
+		if(current_point_number++ == selected_point_number)
 		{
 			selected_point = bit_on;
 			return false;
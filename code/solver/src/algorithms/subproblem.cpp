@@ -0,0 +1,172 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "solver/algorithms/subproblem.hpp"
+#include "solver/data/instance.hpp"
+
+#include <numeric>
+#include <algorithm>
+#include <limits>
+#include <iterator>
+#include <cassert>
+
+uscp::subproblem::points_subsets::points_subsets(const uscp::problem::instance& problem) noexcept
+  : m_problem(problem), m_points_subsets_begin(problem.points_number + 1, 0), m_points_subsets()
+{
+	for(size_t i_subset = 0; i_subset < m_problem.subsets_number; ++i_subset)
+	{
+		m_problem.subsets_points[i_subset].iterate_bits_on(
+		  [&](size_t i_point) noexcept { ++m_points_subsets_begin[i_point + 1]; });
+	}
+	std::partial_sum(m_points_subsets_begin.cbegin(),
+	                 m_points_subsets_begin.cend(),
+	                 m_points_subsets_begin.begin());
+
+	// subsets covering each point, in increasing order
+	m_points_subsets.resize(m_points_subsets_begin.back());
+	std::vector<size_t> points_subsets_end(m_points_subsets_begin.cbegin(),
+	                                       m_points_subsets_begin.cend() - 1);
+	for(size_t i_subset = 0; i_subset < m_problem.subsets_number; ++i_subset)
+	{
+		m_problem.subsets_points[i_subset].iterate_bits_on([&](size_t i_point) noexcept {
+			m_points_subsets[points_subsets_end[i_point]++] = i_subset;
+		});
+	}
+}
+
+size_t uscp::subproblem::points_subsets::subsets_number(size_t point) const noexcept
+{
+	assert(point < m_problem.points_number);
+	return m_points_subsets_begin[point + 1] - m_points_subsets_begin[point];
+}
+
+size_t uscp::subproblem::points_subsets::subset(size_t point, size_t i) const noexcept
+{
+	assert(i < subsets_number(point));
+	return m_points_subsets[m_points_subsets_begin[point] + i];
+}
+
+uscp::problem::instance uscp::subproblem::points_subsets::reduce(
+  const dynamic_bitset<>& authorized_subsets) const noexcept
+{
+	assert(authorized_subsets.size() == m_problem.subsets_number);
+	problem::reduction_info reduction(&m_problem);
+	problem::reduction& applied = reduction.reduction_applied;
+	applied.subsets_dominated = ~authorized_subsets;
+
+	// number of remaining subsets covering each point of the authorized subsets
+	std::vector<size_t> authorized_subsets_list;
+	std::vector<size_t> points_remaining_subsets_number(m_problem.points_number, 0);
+	std::vector<size_t> points_single_subset; // points whose counter reached 1
+	authorized_subsets.iterate_bits_on([&](size_t i_subset) noexcept {
+		authorized_subsets_list.push_back(i_subset);
+		m_problem.subsets_points[i_subset].iterate_bits_on([&](size_t i_point) noexcept {
+			if(++points_remaining_subsets_number[i_point] == 1)
+			{
+				points_single_subset.push_back(i_point);
+			}
+		});
+	});
+
+	// a subset is dominated if another remaining subset covers all its uncovered points,
+	// domination is transitive: only checked again when points get covered
+	dynamic_bitset<> uncovered_points;
+	auto reduce_domination = [&]() noexcept -> bool {
+		bool reduced = false;
+		for(size_t i_subset: authorized_subsets_list)
+		{
+			if(applied.subsets_dominated[i_subset] || applied.subsets_included[i_subset])
+			{
+				continue;
+			}
+			uncovered_points = m_problem.subsets_points[i_subset];
+			uncovered_points -= applied.points_covered;
+
+			// candidates: remaining subsets covering the uncovered point with the fewest subsets
+			size_t rarest_point = m_problem.points_number;
+			size_t rarest_point_subsets_number = std::numeric_limits<size_t>::max();
+			uncovered_points.iterate_bits_on([&](size_t i_point) noexcept {
+				const size_t subsets_number =
+				  m_points_subsets_begin[i_point + 1] - m_points_subsets_begin[i_point];
+				if(subsets_number < rarest_point_subsets_number)
+				{
+					rarest_point = i_point;
+					rarest_point_subsets_number = subsets_number;
+				}
+			});
+			bool dominated = true; // if all its points are covered
+			if(rarest_point < m_problem.points_number)
+			{
+				dominated = false;
+				for(size_t i = m_points_subsets_begin[rarest_point];
+				    i < m_points_subsets_begin[rarest_point + 1] && !dominated;
+				    ++i)
+				{
+					const size_t other_subset = m_points_subsets[i];
+					if(other_subset != i_subset && !applied.subsets_dominated[other_subset])
+					{
+						dominated =
+						  uncovered_points.is_subset_of(m_problem.subsets_points[other_subset]);
+					}
+				}
+			}
+			if(!dominated)
+			{
+				continue;
+			}
+			applied.subsets_dominated.set(i_subset);
+			m_problem.subsets_points[i_subset].iterate_bits_on([&](size_t i_point) noexcept {
+				assert(points_remaining_subsets_number[i_point] > 0);
+				if(--points_remaining_subsets_number[i_point] == 1)
+				{
+					points_single_subset.push_back(i_point);
+				}
+			});
+			reduced = true;
+		}
+		return reduced;
+	};
+
+	// the only remaining subset covering a point is part of all the solutions
+	auto reduce_inclusion = [&]() noexcept -> bool {
+		bool reduced = false;
+		while(!points_single_subset.empty())
+		{
+			const size_t i_point = points_single_subset.back();
+			points_single_subset.pop_back();
+			if(applied.points_covered[i_point] || points_remaining_subsets_number[i_point] != 1)
+			{
+				// covered, or counter increased again while counting the authorized subsets
+				continue;
+			}
+			const auto only_subset_covering_point_it = std::find_if(
+			  m_points_subsets.cbegin() + static_cast<std::ptrdiff_t>(m_points_subsets_begin[i_point]),
+			  m_points_subsets.cbegin()
+			    + static_cast<std::ptrdiff_t>(m_points_subsets_begin[i_point + 1]),
+			  [&](size_t i_subset) noexcept { return !applied.subsets_dominated[i_subset]; });
+			assert(only_subset_covering_point_it
+			       != m_points_subsets.cbegin()
+			            + static_cast<std::ptrdiff_t>(m_points_subsets_begin[i_point + 1]));
+			applied.subsets_included.set(*only_subset_covering_point_it);
+			applied.points_covered |= m_problem.subsets_points[*only_subset_covering_point_it];
+			reduced = true;
+		}
+		return reduced;
+	};
+
+	reduce_domination();
+	while(reduce_inclusion() && reduce_domination())
+	{
+	}
+
+	// the authorized subsets must cover all the points
+	assert(std::all_of(
+	  points_remaining_subsets_number.cbegin(),
+	  points_remaining_subsets_number.cend(),
+	  [](size_t subsets_number) noexcept { return subsets_number > 0; }));
+	return problem::apply_reduction(std::move(reduction), NULL_LOGGER);
+}
@@ -12,6 +12,7 @@
 #include <cassert>
 #include <vector>
 #include <fstream>
+#include <algorithm>
 
 uscp::problem::instance uscp::problem::generate(std::string_view name,
                                                 size_t points_number,
@@ -93,25 +94,42 @@ namespace
 
 	[[gnu::hot]] bool reduce_domination(uscp::problem::reduction_info& reduction) noexcept;
 
-	[[gnu::hot]] bool reduce_inclusion(const std::vector<dynamic_bitset<>>& points_subsets,
+	struct inclusion_data final
+	{
+		// sparse transposed instance matrix
+		std::vector<std::vector<size_t>> points_subsets;
+		std::vector<size_t> subsets_points_number;
+
+		// number of non-dominated subsets covering each point
+		std::vector<size_t> points_remaining_subsets_number;
+		std::vector<size_t> points_single_subset; // points whose counter reached 1
+
+		explicit inclusion_data(const uscp::problem::instance& instance) noexcept;
+	};
+
+	[[gnu::hot]] void update_points_remaining_subsets(
+	  inclusion_data& data,
+	  const uscp::problem::reduction_info& reduction,
+	  const dynamic_bitset<>& new_subsets_dominated) noexcept;
+
+	[[gnu::hot]] bool reduce_inclusion(inclusion_data& data,
 	                                   uscp::problem::reduction_info& reduction) noexcept;
 
+	[[gnu::hot]] bool reduce_points_domination(const inclusion_data& data,
+	                                           uscp::problem::reduction_info& reduction) noexcept;
+
 	[[gnu::hot]] uscp::problem::reduction_info compute_reduction(
 	  const uscp::problem::instance& full_instance) noexcept;
 
-	[[gnu::hot]] uscp::problem::instance apply_reduction(
-	  uscp::problem::reduction_info reduction) noexcept;
-
 	bool reduce_domination_iterate(uscp::problem::reduction_info& reduction) noexcept
 	{
 		timer timer;
 		bool reduced = false;
-		dynamic_bitset<> remaining_subsets = ~(reduction.reduction_applied.subsets_dominated
-		                                       | reduction.reduction_applied.subsets_included);
+		dynamic_bitset<> remaining_subsets = ~reduction.reduction_applied.removed_subsets();
+		dynamic_bitset<> removed_points = reduction.reduction_applied.removed_points();
 		remaining_subsets.iterate_bits_on([&](size_t current_subset_bit_on) {
 			dynamic_bitset<> extended_subset =
-			  (reduction.parent_instance->subsets_points[current_subset_bit_on]
-			   | reduction.reduction_applied.points_covered);
+			  (reduction.parent_instance->subsets_points[current_subset_bit_on] | removed_points);
 			remaining_subsets.iterate_bits_on([&](size_t other_subset_bit_on) {
 				if(reduction.parent_instance->subsets_points[other_subset_bit_on].is_subset_of(
 				     extended_subset))
@@ -133,11 +151,11 @@ namespace
 	{
 		timer timer;
 		bool reduced = false;
-		dynamic_bitset<> ignored_subsets = reduction.reduction_applied.subsets_dominated
-		                                   | reduction.reduction_applied.subsets_included;
+		dynamic_bitset<> ignored_subsets = reduction.reduction_applied.removed_subsets();
+		dynamic_bitset<> removed_points = reduction.reduction_applied.removed_points();
 		dynamic_bitset<> extended_subset; // to minimize memory allocations
-#pragma omp parallel for default(none) shared(reduction, ignored_subsets, reduced) private( \
-  extended_subset) if(reduction.parent_instance->subsets_number > 128)
+#pragma omp parallel for default(none) shared(reduction, ignored_subsets, removed_points, reduced) \
+  private(extended_subset) if(reduction.parent_instance->subsets_number > 128)
 		for(/*no size_t for openMP on Windows*/ int i_current_subset_int = 0;
 		    static_cast<size_t>(i_current_subset_int) < reduction.parent_instance->subsets_number;
 		    ++i_current_subset_int)
@@ -150,7 +168,7 @@ namespace
 				continue;
 			}
 			extended_subset = reduction.parent_instance->subsets_points[i_current_subset];
-			extended_subset |= reduction.reduction_applied.points_covered;
+			extended_subset |= removed_points;
 			for(size_t i_other_subset = 0;
 			    i_other_subset < reduction.parent_instance->subsets_number;
 			    ++i_other_subset)
@@ -181,34 +199,141 @@ namespace
 		return reduced;
 	}
 
-	bool reduce_inclusion(const std::vector<dynamic_bitset<>>& points_subsets,
-	                      uscp::problem::reduction_info& reduction) noexcept
+	inclusion_data::inclusion_data(const uscp::problem::instance& instance) noexcept
+	  : points_subsets(instance.points_number)
+	  , subsets_points_number(instance.subsets_number, 0)
+	  , points_remaining_subsets_number(instance.points_number, 0)
+	  , points_single_subset()
+	{
+		for(size_t i_subset = 0; i_subset < instance.subsets_number; ++i_subset)
+		{
+			instance.subsets_points[i_subset].iterate_bits_on([&](size_t point_bit_on) noexcept {
+				points_subsets[point_bit_on].push_back(i_subset);
+			});
+		}
+		for(size_t i_point = 0; i_point < instance.points_number; ++i_point)
+		{
+			points_remaining_subsets_number[i_point] = points_subsets[i_point].size();
+			if(points_remaining_subsets_number[i_point] == 1)
+			{
+				points_single_subset.push_back(i_point);
+			}
+		}
+		for(size_t i_subset = 0; i_subset < instance.subsets_number; ++i_subset)
+		{
+			subsets_points_number[i_subset] = instance.subsets_points[i_subset].count();
+		}
+	}
+
+	void update_points_remaining_subsets(inclusion_data& data,
+	                                     const uscp::problem::reduction_info& reduction,
+	                                     const dynamic_bitset<>& new_subsets_dominated) noexcept
+	{
+		new_subsets_dominated.iterate_bits_on([&](size_t subset_bit_on) noexcept {
+			reduction.parent_instance->subsets_points[subset_bit_on].iterate_bits_on(
+			  [&](size_t point_bit_on) noexcept {
+				  assert(data.points_remaining_subsets_number[point_bit_on] > 0);
+				  if(--data.points_remaining_subsets_number[point_bit_on] == 1)
+				  {
+					  data.points_single_subset.push_back(point_bit_on);
+				  }
+			  });
+		});
+	}
+
+	bool reduce_inclusion(inclusion_data& data, uscp::problem::reduction_info& reduction) noexcept
+	{
+		timer timer;
+		bool reduced = false;
+		while(!data.points_single_subset.empty())
+		{
+			const size_t i_point = data.points_single_subset.back();
+			data.points_single_subset.pop_back();
+			if(reduction.reduction_applied.points_covered[i_point]
+			   || reduction.reduction_applied.points_dominated[i_point])
+			{
+				// dominated points are covered by any subset covering their dominating point
+				continue;
+			}
+			assert(data.points_remaining_subsets_number[i_point] == 1);
+			const auto only_subset_covering_point_it = std::find_if(
+			  std::cbegin(data.points_subsets[i_point]),
+			  std::cend(data.points_subsets[i_point]),
+			  [&](size_t subset) noexcept {
+				  return !reduction.reduction_applied.subsets_dominated.test(subset);
+			  });
+			assert(only_subset_covering_point_it != std::cend(data.points_subsets[i_point]));
+			const size_t only_subset_covering_point = *only_subset_covering_point_it;
+			reduction.reduction_applied.subsets_included.set(only_subset_covering_point);
+			reduction.parent_instance->subsets_points[only_subset_covering_point].iterate_bits_on(
+			  [&](size_t bit_on) noexcept {
+				  reduction.reduction_applied.points_covered.set(bit_on);
+				  reduction.reduction_applied.points_dominated.reset(bit_on);
+			  });
+			reduced = true;
+		}
+		SPDLOG_LOGGER_DEBUG(LOGGER,
+		                    "({}) Computed inclusion reduction in {}s",
+		                    reduction.parent_instance->name,
+		                    timer.elapsed());
+		return reduced;
+	}
+
+	bool reduce_points_domination(const inclusion_data& data,
+	                              uscp::problem::reduction_info& reduction) noexcept
 	{
 		timer timer;
 		bool reduced = false;
-		dynamic_bitset<> points_remaining_subsets;
+		dynamic_bitset<> removed_points = reduction.reduction_applied.removed_points();
+		std::vector<size_t> point_remaining_subsets;
 		for(size_t i_point = 0; i_point < reduction.parent_instance->points_number; ++i_point)
 		{
-			if(reduction.reduction_applied.points_covered[i_point])
+			if(removed_points[i_point])
 			{
 				continue;
 			}
-			points_remaining_subsets = points_subsets[i_point];
-			points_remaining_subsets -= reduction.reduction_applied.subsets_dominated;
-			assert(points_remaining_subsets.any());
-			if(points_remaining_subsets.count() == 1)
+			point_remaining_subsets.clear();
+			for(size_t subset: data.points_subsets[i_point])
 			{
-				const size_t only_subset_covering_point = points_remaining_subsets.find_first();
-				reduction.reduction_applied.subsets_included.set(only_subset_covering_point);
-				reduction.parent_instance->subsets_points[only_subset_covering_point]
-				  .iterate_bits_on([&](size_t bit_on) noexcept {
-					  reduction.reduction_applied.points_covered.set(bit_on);
-				  });
-				reduced = true;
+				if(!reduction.reduction_applied.subsets_dominated.test(subset))
+				{
+					point_remaining_subsets.push_back(subset);
+				}
 			}
+			assert(!point_remaining_subsets.empty());
+
+			// candidates: points of the smallest subset covering the current point
+			const size_t smallest_subset = *std::min_element(
+			  std::cbegin(point_remaining_subsets),
+			  std::cend(point_remaining_subsets),
+			  [&](size_t a, size_t b) noexcept {
+				  return data.subsets_points_number[a] < data.subsets_points_number[b];
+			  });
+
+			// a point is dominated if all the subsets covering the current point also cover it
+			reduction.parent_instance->subsets_points[smallest_subset].iterate_bits_on(
+			  [&](size_t other_point_bit_on) noexcept {
+				  if(other_point_bit_on == i_point || removed_points[other_point_bit_on])
+				  {
+					  return;
+				  }
+				  const bool dominated = std::all_of(
+				    std::cbegin(point_remaining_subsets),
+				    std::cend(point_remaining_subsets),
+				    [&](size_t subset) noexcept {
+					    return reduction.parent_instance->subsets_points[subset].test(
+					      other_point_bit_on);
+				    });
+				  if(dominated)
+				  {
+					  reduction.reduction_applied.points_dominated.set(other_point_bit_on);
+					  removed_points.set(other_point_bit_on);
+					  reduced = true;
+				  }
+			  });
 		}
 		SPDLOG_LOGGER_DEBUG(LOGGER,
-		                    "({}) Computed inclusion reduction in {}s",
+		                    "({}) Computed points domination reduction in {}s",
 		                    reduction.parent_instance->name,
 		                    timer.elapsed());
 		return reduced;
@@ -219,26 +344,37 @@ namespace
 	{
 		const timer timer;
 
-		// Generate flipped instance matrix
-		std::vector<dynamic_bitset<>> points_subsets;
-		points_subsets.resize(full_instance.points_number);
-		for(dynamic_bitset<>& point_subsets: points_subsets)
-		{
-			point_subsets.resize(full_instance.subsets_number);
-		}
-		for(size_t i_subset = 0; i_subset < full_instance.subsets_number; ++i_subset)
-		{
-			full_instance.subsets_points[i_subset].iterate_bits_on([&](
-			  size_t point_bit_on) noexcept { points_subsets[point_bit_on].set(i_subset); });
-		}
+		// Generate sparse flipped instance matrix and inclusion counters
+		inclusion_data data(full_instance);
 
 		// Compute reduction
 		uscp::problem::reduction_info reduction(&full_instance);
-		reduce_domination(reduction);
-		if(reduce_inclusion(points_subsets, reduction))
+		dynamic_bitset<> subsets_dominated_before(full_instance.subsets_number);
+		auto reduce_domination_update = [&]() noexcept -> bool {
+			subsets_dominated_before = reduction.reduction_applied.subsets_dominated;
+			if(!reduce_domination(reduction))
+			{
+				return false;
+			}
+			update_points_remaining_subsets(
+			  data,
+			  reduction,
+			  reduction.reduction_applied.subsets_dominated - subsets_dominated_before);
+			return true;
+		};
+		reduce_domination_update();
+		while(true)
 		{
-			while(reduce_domination(reduction) && reduce_inclusion(points_subsets, reduction))
-				;
+			const bool points_included = reduce_inclusion(data, reduction);
+			const bool points_dominated = reduce_points_domination(data, reduction);
+			if(!points_included && !points_dominated)
+			{
+				break;
+			}
+			if(!reduce_domination_update())
+			{
+				break;
+			}
 		}
 		if((reduction.reduction_applied.subsets_included
 		    & reduction.reduction_applied.subsets_dominated)
@@ -247,85 +383,78 @@ namespace
 			LOGGER->error("Reduction generated subset dominated and included at the same time");
 			abort();
 		}
+		if((reduction.reduction_applied.points_covered
+		    & reduction.reduction_applied.points_dominated)
+		     .any())
+		{
+			LOGGER->error("Reduction generated point covered and dominated at the same time");
+			abort();
+		}
 		SPDLOG_LOGGER_DEBUG(
 		  LOGGER, "({}) Computed full reduction in {}s", full_instance.name, timer.elapsed());
 		return reduction;
 	}
+} // namespace
 
-	uscp::problem::instance apply_reduction(uscp::problem::reduction_info reduction) noexcept
+uscp::problem::instance uscp::problem::apply_reduction(
+  uscp::problem::reduction_info reduction,
+  std::shared_ptr<spdlog::logger> logger) noexcept
+{
+	const timer timer;
+	const instance& parent_instance = *reduction.parent_instance;
+
+	uscp::problem::instance reduced_instance(reduction);
+	reduced_instance.name = parent_instance.name;
+	const dynamic_bitset<> removed_points = reduction.reduction_applied.removed_points();
+	reduced_instance.points_number = parent_instance.points_number - removed_points.count();
+	reduced_instance.subsets_number = parent_instance.subsets_number
+	                                  - reduction.reduction_applied.subsets_dominated.count()
+	                                  - reduction.reduction_applied.subsets_included.count();
+
+	// index of the points in the reduced instance, points_number if removed
+	std::vector<size_t> points_reduced_index(parent_instance.points_number,
+	                                         parent_instance.points_number);
+	size_t i_point = 0;
+	for(size_t i_point_full_instance = 0; i_point_full_instance < parent_instance.points_number;
+	    ++i_point_full_instance)
 	{
-		const timer timer;
-
-		uscp::problem::instance reduced_instance(reduction);
-		reduced_instance.name = reduction.parent_instance->name;
-		reduced_instance.points_number = reduction.parent_instance->points_number
-		                                 - reduction.reduction_applied.points_covered.count();
-		reduced_instance.subsets_number = reduction.parent_instance->subsets_number
-		                                  - reduction.reduction_applied.subsets_dominated.count()
-		                                  - reduction.reduction_applied.subsets_included.count();
-
-		dynamic_bitset<> removed_subsets = reduction.reduction_applied.subsets_dominated
-		                                   | reduction.reduction_applied.subsets_included;
-		reduced_instance.subsets_points.resize(reduced_instance.subsets_number);
-		size_t i_subset_full_instance = 0;
-		while(removed_subsets[i_subset_full_instance])
-		{
-			++i_subset_full_instance;
-		}
-		for(size_t i_subset = 0; i_subset < reduced_instance.subsets_number; ++i_subset)
-		{
-			assert(i_subset_full_instance < reduction.parent_instance->subsets_number);
-			reduced_instance.subsets_points[i_subset].resize(reduced_instance.points_number);
-			size_t i_point_full_instance = 0;
-			while(reduction.reduction_applied.points_covered[i_point_full_instance])
-			{
-				++i_point_full_instance;
-			}
-			for(size_t i_point = 0; i_point < reduced_instance.points_number; ++i_point)
-			{
-				assert(i_point_full_instance < reduction.parent_instance->points_number);
-				reduced_instance.subsets_points[i_subset][i_point] =
-				  reduction.parent_instance
-				    ->subsets_points[i_subset_full_instance][i_point_full_instance];
-				do
-				{
-					++i_point_full_instance;
-				} while(i_point_full_instance < reduction.parent_instance->points_number
-				        && reduction.reduction_applied.points_covered[i_point_full_instance]);
-			}
-			assert(i_point_full_instance == reduction.parent_instance->points_number);
-			if(i_point_full_instance != reduction.parent_instance->points_number)
-			{
-				LOGGER->error("Solution reduction failed, only {}/{} points for subset {}",
-				              i_subset_full_instance,
-				              reduction.parent_instance->subsets_number,
-				              i_subset_full_instance);
-				abort();
-			}
-			do
-			{
-				++i_subset_full_instance;
-			} while(i_subset_full_instance < reduction.parent_instance->subsets_number
-			        && removed_subsets[i_subset_full_instance]);
-		}
-		assert(i_subset_full_instance == reduction.parent_instance->subsets_number);
-		if(i_subset_full_instance != reduction.parent_instance->subsets_number)
+		if(!removed_points[i_point_full_instance])
 		{
-			LOGGER->error("Solution reduction failed, only {}/{} subsets",
-			              i_subset_full_instance,
-			              reduction.parent_instance->subsets_number);
-			abort();
+			points_reduced_index[i_point_full_instance] = i_point++;
 		}
-		reduced_instance.name += " reduced";
+	}
+	assert(i_point == reduced_instance.points_number);
+
+	dynamic_bitset<> remaining_subsets = reduction.reduction_applied.removed_subsets();
+	remaining_subsets.flip();
+	reduced_instance.subsets_points.reserve(reduced_instance.subsets_number);
+	remaining_subsets.iterate_bits_on([&](size_t i_subset_full_instance) noexcept {
+		dynamic_bitset<>& subset_points =
+		  reduced_instance.subsets_points.emplace_back(reduced_instance.points_number);
+		parent_instance.subsets_points[i_subset_full_instance].iterate_bits_on(
+		  [&](size_t i_point_full_instance) noexcept {
+			  const size_t i_point_reduced = points_reduced_index[i_point_full_instance];
+			  if(i_point_reduced != parent_instance.points_number)
+			  {
+				  subset_points.set(i_point_reduced);
+			  }
+		  });
+	});
+	assert(reduced_instance.subsets_points.size() == reduced_instance.subsets_number);
+	if(reduced_instance.subsets_points.size() != reduced_instance.subsets_number)
+	{
+		LOGGER->error("Solution reduction failed, {}/{} subsets",
+		              reduced_instance.subsets_points.size(),
+		              reduced_instance.subsets_number);
+		abort();
+	}
+	reduced_instance.name += " reduced";
 
-		SPDLOG_LOGGER_DEBUG(LOGGER,
-		                    "({}) Applied reduction in {}s",
-		                    reduction.parent_instance->name,
-		                    timer.elapsed());
+	SPDLOG_LOGGER_DEBUG(
+	  logger, "({}) Applied reduction in {}s", parent_instance.name, timer.elapsed());
 
-		return reduced_instance;
-	}
-} // namespace
+	return reduced_instance;
+}
 
 uscp::problem::instance uscp::problem::reduce(const uscp::problem::instance& full_instance) noexcept
 {
@@ -408,7 +537,8 @@ namespace
 						             reduction_cache_path);
 						if(reduction.subsets_included.size() == full_instance.subsets_number
 						   && reduction.subsets_dominated.size() == full_instance.subsets_number
-						   && reduction.points_covered.size() == full_instance.points_number)
+						   && reduction.points_covered.size() == full_instance.points_number
+						   && reduction.points_dominated.size() == full_instance.points_number)
 						{
 							uscp::problem::reduction_info reduction_info(&full_instance);
 							reduction_info.reduction_applied = reduction;
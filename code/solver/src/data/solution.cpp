@@ -23,7 +23,8 @@ uscp::solution uscp::expand(const uscp::solution& reduced_solution) noexcept
 	     + reduced_solution.problem.reduction->reduction_applied.subsets_included.count())
 	    != reduced_solution.problem.reduction->parent_instance->subsets_number)
 	   || ((reduced_solution.problem.points_number
-	        + reduced_solution.problem.reduction->reduction_applied.points_covered.count())
+	        + reduced_solution.problem.reduction->reduction_applied.points_covered.count()
+	        + reduced_solution.problem.reduction->reduction_applied.points_dominated.count())
 	       != reduced_solution.problem.reduction->parent_instance->points_number))
 	{
 		LOGGER->error("Tried to expand solution of an invalid reduced instance");
@@ -36,6 +37,11 @@ uscp::solution uscp::expand(const uscp::solution& reduced_solution) noexcept
 	do
 	{
 		passed = false;
+		if(i_expanded >= expanded_solution.problem.subsets_number)
+		{
+			// all the subsets removed
+			break;
+		}
 		if(reduced_solution.problem.reduction->reduction_applied.subsets_included[i_expanded])
 		{
 			expanded_solution.selected_subsets.set(i_expanded);
@@ -9,15 +9,20 @@
 #include "solver/algorithms/greedy.hpp"
 #include "solver/algorithms/rwls.hpp"
 #include "solver/algorithms/memetic.hpp"
+#include "solver/algorithms/lagrangian.hpp"
+#include "solver/algorithms/core.hpp"
+#include "solver/algorithms/adaptive.hpp"
 #include "solver/algorithms/crossovers/identity.hpp"
 #include "solver/algorithms/crossovers/merge.hpp"
 #include "solver/algorithms/crossovers/greedy_merge.hpp"
+#include "solver/algorithms/crossovers/pruned_merge.hpp"
 #include "solver/algorithms/crossovers/subproblem_random.hpp"
 #include "solver/algorithms/crossovers/extended_subproblem_random.hpp"
 #include "solver/algorithms/crossovers/subproblem_greedy.hpp"
 #include "solver/algorithms/crossovers/extended_subproblem_greedy.hpp"
 #include "solver/algorithms/crossovers/subproblem_rwls.hpp"
 #include "solver/algorithms/crossovers/extended_subproblem_rwls.hpp"
+#include "solver/algorithms/crossovers/subproblem_exact.hpp"
 #include "solver/algorithms/wcrossover/reset.hpp"
 #include "solver/algorithms/wcrossover/keep.hpp"
 #include "solver/algorithms/wcrossover/average.hpp"
@@ -29,6 +34,7 @@
 #include "solver/algorithms/wcrossover/minmax.hpp"
 #include "solver/algorithms/wcrossover/shuffle.hpp"
 #include "solver/data/instances.hpp"
+#include "solver/utils/async_file_writer.hpp"
 #include "common/utils/logger.hpp"
 #include "common/utils/random.hpp"
 #include "common/data/instance.hpp"
@@ -49,6 +55,9 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <optional>
+#include <random>
+#include <cstdint>
 
 namespace
 {
@@ -67,6 +76,12 @@ namespace
 		// general options
 		std::string output_prefix = "solver_out_";
 		size_t repetitions = 1;
+		std::optional<uint64_t> seed;
+		bool lower_bound = false;
+
+		// core options
+		bool core = false;
+		uscp::core::config core_config;
 
 		// greedy options
 		bool greedy = false;
@@ -80,6 +95,13 @@ namespace
 		uscp::memetic::config memetic_config;
 		std::string memetic_crossover;
 		std::string memetic_wcrossover;
+		std::string memetic_resume_path;
+		std::optional<uscp::memetic::checkpoint> memetic_resume; // used by the first matching run
+		size_t memetic_resume_repetition = 0;                    // repetition of the checkpoint
+		std::vector<nlohmann::json> memetic_resume_reports;      // its previous repetitions
+
+		// results of the instances already processed, saved in the memetic checkpoints
+		std::vector<nlohmann::json> finished_instances;
 	};
 
 	template<typename... Crossovers>
@@ -149,32 +171,57 @@ namespace
 		return false;
 	}
 
-	using all_crossovers = crossovers<uscp::crossover::identity,
-	                                  uscp::crossover::merge,
-	                                  uscp::crossover::greedy_merge,
-	                                  uscp::crossover::subproblem_random,
-	                                  uscp::crossover::extended_subproblem_random,
-	                                  uscp::crossover::subproblem_greedy,
-	                                  uscp::crossover::extended_subproblem_greedy,
-	                                  uscp::crossover::subproblem_rwls,
-	                                  uscp::crossover::extended_subproblem_rwls>;
-
-	using all_wcrossovers = wcrossovers<uscp::wcrossover::reset,
-	                                    uscp::wcrossover::keep,
-	                                    uscp::wcrossover::average,
-	                                    uscp::wcrossover::mix_random,
-	                                    uscp::wcrossover::add,
-	                                    uscp::wcrossover::difference,
-	                                    uscp::wcrossover::max,
-	                                    uscp::wcrossover::min,
-	                                    uscp::wcrossover::minmax,
-	                                    uscp::wcrossover::shuffle>;
+	using operators_crossovers = crossovers<uscp::crossover::identity,
+	                                        uscp::crossover::merge,
+	                                        uscp::crossover::greedy_merge,
+	                                        uscp::crossover::pruned_merge,
+	                                        uscp::crossover::subproblem_random,
+	                                        uscp::crossover::extended_subproblem_random,
+	                                        uscp::crossover::subproblem_greedy,
+	                                        uscp::crossover::extended_subproblem_greedy,
+	                                        uscp::crossover::subproblem_rwls,
+	                                        uscp::crossover::extended_subproblem_rwls,
+	                                        uscp::crossover::subproblem_exact>;
+
+	using operators_wcrossovers = wcrossovers<uscp::wcrossover::reset,
+	                                          uscp::wcrossover::keep,
+	                                          uscp::wcrossover::average,
+	                                          uscp::wcrossover::mix_random,
+	                                          uscp::wcrossover::add,
+	                                          uscp::wcrossover::difference,
+	                                          uscp::wcrossover::max,
+	                                          uscp::wcrossover::min,
+	                                          uscp::wcrossover::minmax,
+	                                          uscp::wcrossover::shuffle>;
 
 	template<typename Lambda>
 	bool forall_crossover_wcrossover(Lambda&& lambda) noexcept
 	{
 		return foreach_crossover_wcrossover(
-		  std::forward<Lambda>(lambda), all_crossovers{}, all_wcrossovers{});
+		  std::forward<Lambda>(lambda), operators_crossovers{}, operators_wcrossovers{});
+	}
+
+	// adaptive: all the operators in a single run, selected each generation by a bandit, a
+	// single memetic instantiation with the operator not adaptive pinned in its pool
+	template<typename... Operators>
+	uscp::adaptive::pool<Operators...> make_pool(crossovers<Operators...>);
+	template<typename... Operators>
+	uscp::adaptive::pool<Operators...> make_pool(wcrossovers<Operators...>);
+
+	using adaptive_crossover = decltype(make_pool(operators_crossovers{}));
+	using adaptive_wcrossover = decltype(make_pool(operators_wcrossovers{}));
+
+	template<typename Pool>
+	bool has_operator(std::string_view name) noexcept
+	{
+		for(size_t i_operator = 0; i_operator < Pool::operators_number; ++i_operator)
+		{
+			if(Pool::operator_name(i_operator) == name)
+			{
+				return true;
+			}
+		}
+		return false;
 	}
 
 	std::optional<nlohmann::json> process_instance(program_options& program_options,
@@ -200,6 +247,51 @@ namespace
 
 		nlohmann::json data_instance;
 		data_instance["instance"] = instance_base.serialize();
+
+		// lower bound of the reduced instance, the included subsets are in all the solutions
+		size_t lower_bound = 0;
+		size_t reduced_lower_bound = 0;
+		uscp::lagrangian::report lagrangian_report;
+		if(program_options.lower_bound || program_options.core)
+		{
+			// multipliers used to price the subsets of the cores
+			lagrangian_report = uscp::lagrangian::lower_bound(instance);
+		}
+		if(program_options.lower_bound)
+		{
+			reduced_lower_bound = lagrangian_report.lower_bound;
+			lower_bound = reduced_lower_bound;
+			if(instance.reduction)
+			{
+				lower_bound += instance.reduction->reduction_applied.subsets_included.count();
+			}
+			LOGGER->info("({}) Lower bound: {} subsets", instance_base.name, lower_bound);
+			data_instance["lower_bound"] = {
+			  {"lower_bound", lower_bound},
+			  {"lagrangian_bound", lagrangian_report.lagrangian_bound},
+			  {"iterations", lagrangian_report.iterations},
+			  {"time", lagrangian_report.time},
+			};
+		}
+		auto serialize_with_gap = [&](const auto& report) {
+			nlohmann::json data_report = report.serialize();
+			if(program_options.lower_bound)
+			{
+				const size_t subsets_number = report.solution_final.selected_subsets.count();
+				if(subsets_number < lower_bound)
+				{
+					LOGGER->error("({}) Lower bound {} above the solution size {}",
+					              instance_base.name,
+					              lower_bound,
+					              subsets_number);
+				}
+				else
+				{
+					data_report["gap"] = subsets_number - lower_bound;
+				}
+			}
+			return data_report;
+		};
 		if(program_options.greedy && !program_options.rwls)
 		{
 			uscp::greedy::report greedy_report = uscp::greedy::solve_report(instance);
@@ -217,14 +309,14 @@ namespace
 				LOGGER->info("({}) Greedy found solution with {} subsets",
 				             instance_base.name,
 				             expanded_greedy_report.solution_final.selected_subsets.count());
-				data_instance["greedy"] = expanded_greedy_report.serialize();
+				data_instance["greedy"] = serialize_with_gap(expanded_greedy_report);
 			}
 			else
 			{
 				LOGGER->info("({}) Greedy found solution with {} subsets",
 				             instance_base.name,
 				             greedy_report.solution_final.selected_subsets.count());
-				data_instance["greedy"] = greedy_report.serialize();
+				data_instance["greedy"] = serialize_with_gap(greedy_report);
 			}
 		}
 		if(program_options.rwls)
@@ -247,23 +339,32 @@ namespace
 					LOGGER->info("({}) Greedy found solution with {} subsets",
 					             instance_base.name,
 					             expanded_greedy_report.solution_final.selected_subsets.count());
-					data_instance["greedy"] = expanded_greedy_report.serialize();
+					data_instance["greedy"] = serialize_with_gap(expanded_greedy_report);
 				}
 				else
 				{
 					LOGGER->info("({}) Greedy found solution with {} subsets",
 					             instance_base.name,
 					             greedy_report.solution_final.selected_subsets.count());
-					data_instance["greedy"] = greedy_report.serialize();
+					data_instance["greedy"] = serialize_with_gap(greedy_report);
 				}
 			}
 			std::vector<nlohmann::json> data_rwls;
 			uscp::rwls::rwls rwls_manager(instance);
-			rwls_manager.initialize();
+			rwls_manager.set_lower_bound(reduced_lower_bound);
+			uscp::core::config core_config = program_options.core_config;
+			core_config.lower_bound = reduced_lower_bound;
 			for(size_t repetition = 0; repetition < program_options.repetitions; ++repetition)
 			{
-				uscp::rwls::report rwls_report = rwls_manager.improve(
-				  greedy_report.solution_final, generator, program_options.rwls_stop);
+				uscp::rwls::report rwls_report =
+				  program_options.core
+				    ? uscp::core::improve(greedy_report.solution_final,
+				                          lagrangian_report.multipliers,
+				                          generator,
+				                          program_options.rwls_stop,
+				                          core_config)
+				    : rwls_manager.improve(
+				        greedy_report.solution_final, generator, program_options.rwls_stop);
 				if(reduce)
 				{
 					uscp::rwls::report expanded_rwls_report = uscp::rwls::expand(rwls_report);
@@ -279,7 +380,7 @@ namespace
 					             instance_base.name,
 					             expanded_rwls_report.solution_initial.selected_subsets.count(),
 					             expanded_rwls_report.solution_final.selected_subsets.count());
-					data_rwls.emplace_back(expanded_rwls_report.serialize());
+					data_rwls.push_back(serialize_with_gap(expanded_rwls_report));
 				}
 				else
 				{
@@ -287,20 +388,67 @@ namespace
 					             instance_base.name,
 					             rwls_report.solution_initial.selected_subsets.count(),
 					             rwls_report.solution_final.selected_subsets.count());
-					data_rwls.emplace_back(rwls_report.serialize());
+					data_rwls.push_back(serialize_with_gap(rwls_report));
 				}
 			}
 			data_instance["rwls"] = std::move(data_rwls);
 		}
 		if(program_options.memetic)
 		{
+			uscp::memetic::config memetic_config = program_options.memetic_config;
+			memetic_config.lower_bound = reduced_lower_bound;
+
+			// single core: pricing again would restart the population
+			std::optional<uscp::problem::instance> core_instance;
+			if(program_options.core)
+			{
+				core_instance = uscp::core::pricing(instance).build_core(
+				  lagrangian_report.multipliers,
+				  uscp::greedy::solve(instance).selected_subsets,
+				  program_options.core_config);
+				LOGGER->info("({}) Memetic on a core of {}/{} subsets",
+				             instance_base.name,
+				             core_instance->subsets_number,
+				             instance.subsets_number);
+			}
+			const uscp::problem::instance& memetic_instance = core_instance ? *core_instance : instance;
+
 			auto process_memetic = [&](auto memetic_alg) -> bool {
 				std::vector<nlohmann::json> data_memetic;
 				memetic_alg.initialize();
-				for(size_t repetition = 0; repetition < program_options.repetitions; ++repetition)
+				std::optional<uscp::memetic::checkpoint> resume;
+				size_t first_repetition = 0;
+				if(program_options.memetic_resume
+				   && program_options.memetic_resume->problem_name == memetic_instance.name)
 				{
+					if(!program_options.memetic_resume->compatible(memetic_instance,
+					                                               program_options.memetic_crossover,
+					                                               program_options.memetic_wcrossover))
+					{
+						LOGGER->error("({}) Invalid checkpoint to resume: {}",
+						              instance_base.name,
+						              program_options.memetic_resume_path);
+						return false;
+					}
+					resume = std::move(program_options.memetic_resume);
+					program_options.memetic_resume.reset();
+					first_repetition = program_options.memetic_resume_repetition;
+					data_memetic = std::move(program_options.memetic_resume_reports);
+				}
+				for(size_t repetition = first_repetition; repetition < program_options.repetitions;
+				    ++repetition)
+				{
+					// the checkpoints resume this repetition after the finished runs
+					memetic_config.checkpoint_progress =
+					  nlohmann::json{{"instances", program_options.finished_instances},
+					                 {"memetic", data_memetic},
+					                 {"repetition", repetition}}
+					    .dump();
+					uscp::memetic::report solve_report =
+					  memetic_alg.solve(generator, memetic_config, resume ? &*resume : nullptr);
+					resume.reset();
 					uscp::memetic::report memetic_report =
-					  memetic_alg.solve(generator, program_options.memetic_config);
+					  core_instance ? uscp::memetic::expand(solve_report) : std::move(solve_report);
 					if(reduce)
 					{
 						uscp::memetic::report expanded_memetic_report =
@@ -318,14 +466,14 @@ namespace
 						  "({}) Memetic found solution with {} subsets",
 						  instance_base.name,
 						  expanded_memetic_report.solution_final.selected_subsets.count());
-						data_memetic.emplace_back(expanded_memetic_report.serialize());
+						data_memetic.push_back(serialize_with_gap(expanded_memetic_report));
 					}
 					else
 					{
 						LOGGER->info("({}) Memetic found solution with {} subsets",
 						             instance_base.name,
 						             memetic_report.solution_final.selected_subsets.count());
-						data_memetic.emplace_back(memetic_report.serialize());
+						data_memetic.push_back(serialize_with_gap(memetic_report));
 					}
 				}
 				data_instance["memetic"] = std::move(data_memetic);
@@ -345,7 +493,7 @@ namespace
 					{
 						found_wcrossover = true;
 						uscp::memetic::memetic<crossover_type, wcrossover_type> memetic_alg_(
-						  instance);
+						  memetic_instance);
 						if(process_memetic(memetic_alg_))
 						{
 							success = true;
@@ -355,6 +503,30 @@ namespace
 				}
 				return true;
 			});
+			const bool adaptive_crossover_selected =
+			  program_options.memetic_crossover == adaptive_crossover::to_string();
+			const bool adaptive_wcrossover_selected =
+			  program_options.memetic_wcrossover == adaptive_wcrossover::to_string();
+			if(!found_wcrossover && (adaptive_crossover_selected || adaptive_wcrossover_selected))
+			{
+				found_crossover =
+				  adaptive_crossover_selected
+				  || has_operator<adaptive_crossover>(program_options.memetic_crossover);
+				found_wcrossover =
+				  found_crossover
+				  && (adaptive_wcrossover_selected
+				      || has_operator<adaptive_wcrossover>(program_options.memetic_wcrossover));
+				if(found_wcrossover)
+				{
+					memetic_config.crossover =
+					  adaptive_crossover_selected ? "" : program_options.memetic_crossover;
+					memetic_config.wcrossover =
+					  adaptive_wcrossover_selected ? "" : program_options.memetic_wcrossover;
+					uscp::memetic::memetic<adaptive_crossover, adaptive_wcrossover> memetic_alg_(
+					  memetic_instance);
+					success = process_memetic(memetic_alg_);
+				}
+			}
 			if(!found_crossover)
 			{
 				LOGGER->error("No crossover operator named \"{}\" exist",
@@ -380,9 +552,32 @@ namespace
 	  program_options& program_options,
 	  uscp::random_engine& generator) noexcept
 	{
-		std::vector<nlohmann::json> data_instances;
-		for(const std::string& instance_name: program_options.instances)
+		// resumed run: the instances before the checkpointed one are already finished
+		std::vector<nlohmann::json>& data_instances = program_options.finished_instances;
+		if(data_instances.size() > program_options.instances.size())
+		{
+			LOGGER->error("The checkpoint has more finished instances than the instances to solve");
+			return {};
+		}
+		for(size_t i_instance = 0; i_instance < data_instances.size(); ++i_instance)
+		{
+			const std::string& finished_name =
+			  data_instances[i_instance]["instance"]["name"].get_ref<const std::string&>();
+			if(finished_name != program_options.instances[i_instance])
+			{
+				LOGGER->error("The checkpoint finished instance {} is not the instance {} to solve",
+				              finished_name,
+				              program_options.instances[i_instance]);
+				return {};
+			}
+			LOGGER->info("Instance {} already solved before the checkpoint",
+			             program_options.instances[i_instance]);
+		}
+		for(size_t i_instance = data_instances.size();
+		    i_instance < program_options.instances.size();
+		    ++i_instance)
 		{
+			const std::string& instance_name = program_options.instances[i_instance];
 			const auto instance_it =
 			  std::find_if(std::cbegin(uscp::problem::instances),
 			               std::cend(uscp::problem::instances),
@@ -482,6 +677,10 @@ int main(int argc, char* argv[])
 	const std::string valid_instance_types = instance_types_stream.str();
 	const std::string default_output_prefix = "solver_out_";
 	const std::string default_repetitions = "1";
+	const std::string default_lower_bound = "false";
+	const std::string default_core = "false";
+	const std::string default_core_subsets_per_point = "5";
+	const std::string default_core_pricing_period = "60";
 	const std::string default_greedy = "false";
 	const std::string default_rwls = "false";
 	const std::string default_rwls_steps = std::to_string(std::numeric_limits<size_t>::max());
@@ -492,6 +691,11 @@ int main(int argc, char* argv[])
 	const std::string default_memetic_cumulative_rwls_time =
 	  std::to_string(std::numeric_limits<size_t>::max());
 	const std::string default_memetic_time = std::to_string(std::numeric_limits<size_t>::max());
+	const std::string default_memetic_population_size = "2";
+	const std::string default_memetic_islands = "1";
+	const std::string default_memetic_migration_interval = "10";
+	const std::string default_memetic_steady_state = "false";
+	const std::string default_memetic_checkpoint_period = "600";
 	const std::string default_memetic_crossover = "default";
 	const std::string default_memetic_wcrossover = "default";
 
@@ -516,8 +720,8 @@ int main(int argc, char* argv[])
 		     "\n"
 		     "Known instances: 4.1,4.2,4.3,4.4,4.5,4.6,4.7,4.8,4.9,4.10,5.1,5.2,5.3,5.4,5.5,5.6,5.7,5.8,5.9,5.10,6.1,6.2,6.3,6.4,6.5,A.1,A.2,A.3,A.4,A.5,B.1,B.2,B.3,B.4,B.5,C.1,C.2,C.3,C.4,C.5,D.1,D.2,D.3,D.4,D.5,E.1,E.2,E.3,E.4,E.5,NRE.1,NRE.2,NRE.3,NRE.4,NRE.5,NRF.1,NRF.2,NRF.3,NRF.4,NRF.5,NRG.1,NRG.2,NRG.3,NRG.4,NRG.5,NRH.1,NRH.2,NRH.3,NRH.4,NRH.5,CLR10,CLR11,CLR12,CLR13,CYC6,CYC7,CYC8,CYC9,CYC10,CYC11,RAIL507,RAIL516,RAIL582,RAIL2536,RAIL2586,RAIL4284,RAIL4872,STS9,STS15,STS27,STS45,STS81,STS135,STS243,STS405,STS729,STS1215,STS2187\n"
 		     "\n"
-		     "Implemented crossovers: identity, merge, greedy_merge, subproblem_random, extended_subproblem_random, subproblem_greedy, extended_subproblem_greedy, subproblem_rwls, extended_subproblem_rwls\n"
-		     "Implemented wcrossovers: reset, keep, average, mix_random, add, difference, max, min, minmax, shuffle\n"
+		     "Implemented crossovers: identity, merge, greedy_merge, pruned_merge, subproblem_random, extended_subproblem_random, subproblem_greedy, extended_subproblem_greedy, subproblem_rwls, extended_subproblem_rwls, subproblem_exact, adaptive (all of them, selected during the run by a bandit on the improvement per second)\n"
+		     "Implemented wcrossovers: reset, keep, average, mix_random, add, difference, max, min, minmax, shuffle, adaptive\n"
 		     "\n"
 		     "Usage examples:\n"
 		     "  Solve CYC10 and CYC11 instances with RWLS and a limit of 5000 steps:\n"
@@ -566,6 +770,44 @@ int main(int argc, char* argv[])
 		    "Repetitions number",
 		    cxxopts::value<size_t>(program_options.repetitions)->default_value(default_repetitions),
 		    "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option("seed",
+		                  "Random generator seed, runs are reproducible for a given seed and "
+		                  "threads number (default: random seed)",
+		                  cxxopts::value<uint64_t>(),
+		                  "N"));
+
+		options.add_option(
+		  "",
+		  cxxopts::Option("lower_bound",
+		                  "Compute a Lagrangian lower bound before solving: RWLS and memetic stop "
+		                  "when it is reached and the gaps are reported",
+		                  cxxopts::value<bool>(program_options.lower_bound)
+		                    ->default_value(default_lower_bound)));
+
+		// Core
+		options.add_option(
+		  "",
+		  cxxopts::Option("core",
+		                  "Solve on a core of the subsets with the smallest Lagrangian reduced "
+		                  "costs: RWLS prices all the subsets again periodically, memetic uses a "
+		                  "single core",
+		                  cxxopts::value<bool>(program_options.core)->default_value(default_core)));
+		options.add_option(
+		  "",
+		  cxxopts::Option("core_subsets_per_point",
+		                  "Subsets with the smallest reduced costs kept in the core for each point",
+		                  cxxopts::value<size_t>(program_options.core_config.subsets_per_point)
+		                    ->default_value(default_core_subsets_per_point),
+		                  "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option("core_pricing_period",
+		                  "RWLS time (seconds) on a core before pricing all the subsets again",
+		                  cxxopts::value<double>(program_options.core_config.pricing_period)
+		                    ->default_value(default_core_pricing_period),
+		                  "N"));
 
 		// Greedy
 		options.add_option(
@@ -626,6 +868,57 @@ int main(int argc, char* argv[])
 		                                     program_options.memetic_config.stopping_criterion.time)
 		                                     ->default_value(default_memetic_time),
 		                                   "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option("memetic_population_size",
+		                  "Memetic population size (at least 2)",
+		                  cxxopts::value<size_t>(program_options.memetic_config.population_size)
+		                    ->default_value(default_memetic_population_size),
+		                  "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option("memetic_islands",
+		                  "Memetic islands number, each one running in its own thread",
+		                  cxxopts::value<size_t>(program_options.memetic_config.islands_number)
+		                    ->default_value(default_memetic_islands),
+		                  "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option(
+		    "memetic_migration_interval",
+		    "Memetic generations between migrations of the islands best solutions (0 to disable)",
+		    cxxopts::value<size_t>(program_options.memetic_config.migration_interval)
+		      ->default_value(default_memetic_migration_interval),
+		    "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option(
+		    "memetic_steady_state",
+		    "Memetic steady-state mode: asynchronous RWLS and crossovers on all cores",
+		    cxxopts::value<bool>(program_options.memetic_config.steady_state)
+		      ->default_value(default_memetic_steady_state)));
+		options.add_option(
+		  "",
+		  cxxopts::Option("memetic_checkpoint",
+		                  "Memetic checkpoint file, periodically saved to resume the run (default: "
+		                  "resume file if any, otherwise no checkpoint)",
+		                  cxxopts::value<std::string>(program_options.memetic_config.checkpoint_path),
+		                  "PATH"));
+		options.add_option(
+		  "",
+		  cxxopts::Option("memetic_checkpoint_period",
+		                  "Memetic checkpoint period (seconds)",
+		                  cxxopts::value<double>(program_options.memetic_config.checkpoint_period)
+		                    ->default_value(default_memetic_checkpoint_period),
+		                  "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option("resume",
+		                  "Resume the memetic run saved in the checkpoint file, with the remaining "
+		                  "time and cumulative RWLS limits and after the finished instances and "
+		                  "repetitions (same instances and operators)",
+		                  cxxopts::value<std::string>(program_options.memetic_resume_path),
+		                  "PATH"));
 		options.add_option(
 		  "",
 		  cxxopts::Option("memetic_crossover",
@@ -648,6 +941,11 @@ int main(int argc, char* argv[])
 			return EXIT_SUCCESS;
 		}
 
+		if(result.count("seed"))
+		{
+			program_options.seed = result["seed"].as<uint64_t>();
+		}
+
 		if(result.count("version"))
 		{
 			std::cout << "Build commit: " << git_info::head_sha1;
@@ -677,6 +975,30 @@ int main(int argc, char* argv[])
 			std::cout << "0 repetitions, nothing to do" << std::endl;
 			return EXIT_SUCCESS;
 		}
+
+		if(program_options.memetic && program_options.memetic_config.population_size < 2)
+		{
+			std::cout << "Memetic population size must be at least 2" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		if(program_options.memetic && program_options.memetic_config.islands_number == 0)
+		{
+			std::cout << "Memetic islands number must be at least 1" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		if(!program_options.memetic_resume_path.empty() && !program_options.memetic)
+		{
+			std::cout << "Only memetic runs can be resumed" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		if(!program_options.memetic_resume_path.empty()
+		   && program_options.memetic_config.checkpoint_path.empty())
+		{
+			program_options.memetic_config.checkpoint_path = program_options.memetic_resume_path;
+		}
 	}
 	catch(const std::exception& e)
 	{
@@ -721,7 +1043,57 @@ int main(int argc, char* argv[])
 		data["date"] = now_txt.str();
 
 		// Process instances: generate data
-		uscp::random_engine generator(std::random_device{}());
+		uint64_t seed = 0;
+		if(program_options.seed.has_value())
+		{
+			seed = *program_options.seed;
+		}
+		else
+		{
+			std::random_device random_device;
+			seed = (static_cast<uint64_t>(random_device()) << 32) | random_device();
+		}
+		LOGGER->info("Random generator seed: {}", seed);
+		data["seed"] = seed;
+		uscp::random_engine generator(seed);
+		if(!program_options.memetic_resume_path.empty())
+		{
+			// the checkpoint generators replace the seeded one for the resumed run
+			std::optional<std::vector<char>> checkpoint_data =
+			  uscp::read_file(program_options.memetic_resume_path);
+			uscp::memetic::checkpoint checkpoint;
+			if(!checkpoint_data || !checkpoint.load(*checkpoint_data))
+			{
+				LOGGER->error("Failed to load checkpoint {}", program_options.memetic_resume_path);
+				return EXIT_FAILURE;
+			}
+			LOGGER->info("Resume memetic run of instance {} at generation {} from checkpoint {}",
+			             checkpoint.problem_name,
+			             checkpoint.generation,
+			             program_options.memetic_resume_path);
+			try
+			{
+				// results of the runs finished before the checkpoint
+				const nlohmann::json progress = nlohmann::json::parse(checkpoint.progress);
+				progress.at("instances").get_to(program_options.finished_instances);
+				for(const nlohmann::json& finished_instance: program_options.finished_instances)
+				{
+					finished_instance.at("instance").at("name").get<std::string>();
+				}
+				progress.at("memetic").get_to(program_options.memetic_resume_reports);
+				progress.at("repetition").get_to(program_options.memetic_resume_repetition);
+			}
+			catch(const std::exception& e)
+			{
+				LOGGER->error("Invalid checkpoint progress: {}", e.what());
+				return EXIT_FAILURE;
+			}
+			LOGGER->info("Resume after {} finished instances and {} finished repetitions",
+			             program_options.finished_instances.size(),
+			             program_options.memetic_resume_repetition);
+			data["resumed_from"] = program_options.memetic_resume_path;
+			program_options.memetic_resume = std::move(checkpoint);
+		}
 		std::optional<std::vector<nlohmann::json>> data_registered_instances =
 		  process_registered_instances(program_options, generator);
 		if(!data_registered_instances)
@@ -742,6 +1114,11 @@ int main(int argc, char* argv[])
 			data_instances.push_back(std::move(*data_unknown_instances));
 		}
 		data["instances"] = std::move(data_instances);
+		if(program_options.memetic_resume)
+		{
+			LOGGER->warn("Checkpoint of instance {} not used: no memetic run on this instance",
+			             program_options.memetic_resume->problem_name);
+		}
 
 		// save data
 		std::ostringstream file_data_stream;
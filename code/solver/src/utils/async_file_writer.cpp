@@ -0,0 +1,97 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "solver/utils/async_file_writer.hpp"
+#include "common/utils/logger.hpp"
+
+#include <fstream>
+#include <filesystem>
+#include <iterator>
+#include <utility>
+
+uscp::async_file_writer::async_file_writer(std::string path) noexcept
+  : m_path(std::move(path)), m_mutex(), m_condition(), m_pending(), m_stop(false), m_thread()
+{
+	m_thread = std::thread(&async_file_writer::run, this);
+}
+
+uscp::async_file_writer::~async_file_writer() noexcept
+{
+	{
+		const std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_condition.notify_one();
+	m_thread.join();
+}
+
+void uscp::async_file_writer::write(std::vector<char> data) noexcept
+{
+	{
+		const std::lock_guard<std::mutex> lock(m_mutex);
+		m_pending = std::move(data);
+	}
+	m_condition.notify_one();
+}
+
+void uscp::async_file_writer::run() noexcept
+{
+	const std::string tmp_path = m_path + ".tmp";
+	while(true)
+	{
+		std::vector<char> data;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [&]() noexcept { return m_stop || m_pending.has_value(); });
+			if(!m_pending)
+			{
+				return;
+			}
+			data = std::move(*m_pending);
+			m_pending.reset();
+		}
+
+		std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+		if(!file)
+		{
+			LOGGER->warn("Failed to open {}", tmp_path);
+			continue;
+		}
+		file.write(data.data(), static_cast<std::streamsize>(data.size()));
+		file.close();
+		if(!file)
+		{
+			LOGGER->warn("Failed to write {}", tmp_path);
+			continue;
+		}
+		std::error_code error;
+		std::filesystem::rename(tmp_path, m_path, error);
+		if(error)
+		{
+			LOGGER->warn("Failed to rename {} to {}: {}", tmp_path, m_path, error.message());
+			continue;
+		}
+		SPDLOG_LOGGER_DEBUG(LOGGER, "Written {} bytes to {}", data.size(), m_path);
+	}
+}
+
+std::optional<std::vector<char>> uscp::read_file(const std::string& path) noexcept
+{
+	std::ifstream file(path, std::ios::binary);
+	if(!file)
+	{
+		LOGGER->warn("Failed to open {}", path);
+		return {};
+	}
+	std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	if(file.bad())
+	{
+		LOGGER->warn("Failed to read {}", path);
+		return {};
+	}
+	return data;
+}
@@ -0,0 +1,43 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "solver/utils/binary.hpp"
+
+void uscp::binary_writer::write(const std::string& value) noexcept
+{
+	write(value.size());
+	const size_t position = m_data.size();
+	m_data.resize(position + value.size());
+	std::memcpy(m_data.data() + position, value.data(), value.size());
+}
+
+std::vector<char>& uscp::binary_writer::data() noexcept
+{
+	return m_data;
+}
+
+uscp::binary_reader::binary_reader(const std::vector<char>& data) noexcept
+  : m_data(data), m_position(0)
+{
+}
+
+bool uscp::binary_reader::read(std::string& value) noexcept
+{
+	size_t size = 0;
+	if(!read(size) || m_data.size() - m_position < size)
+	{
+		return false;
+	}
+	value.assign(m_data.data() + m_position, size);
+	m_position += size;
+	return true;
+}
+
+bool uscp::binary_reader::finished() const noexcept
+{
+	return m_position == m_data.size();
+}
@@ -10,6 +10,8 @@
 #include <cassert>
 #include <algorithm>
 #include <iterator>
+#include <numeric>
+#include <limits>
 
 std::vector<std::vector<dynamic_bitset<>>> generate_permutations(size_t bitsets_size)
 {
@@ -157,3 +159,130 @@ void increment(dynamic_bitset<>& bitset)
 		}
 	}
 }
+
+RevolvingDoorGenerator::RevolvingDoorGenerator(size_t elements_number,
+                                               size_t combination_size,
+                                               size_t first_rank) noexcept
+  : m_elements_number(elements_number), m_combination(combination_size)
+{
+	assert(combination_size <= elements_number);
+	assert(first_rank < binomial(elements_number, combination_size));
+
+	// the order of n elements is the order of n - 1 elements without the last element,
+	// then the reversed order of n - 1 elements with one element less, with the last element
+	size_t rank = first_rank;
+	size_t remaining = combination_size;
+	for(size_t n = elements_number; remaining > 0; --n)
+	{
+		if(remaining == n)
+		{
+			for(size_t i = 0; i < remaining; ++i)
+			{
+				m_combination[i] = i;
+			}
+			break;
+		}
+		const size_t without_last = binomial(n - 1, remaining);
+		if(rank >= without_last)
+		{
+			m_combination[--remaining] = n - 1;
+			rank = binomial(n - 1, remaining) - 1 - (rank - without_last);
+		}
+	}
+}
+
+const std::vector<size_t>& RevolvingDoorGenerator::combination() const noexcept
+{
+	return m_combination;
+}
+
+bool RevolvingDoorGenerator::next(size_t& removed, size_t& added) noexcept
+{
+	// 1-indexed as in the algorithm, c(t + 1) is the elements number
+	const size_t t = m_combination.size();
+	if(t == 0)
+	{
+		return false;
+	}
+	auto c = [&](size_t j) noexcept -> size_t& { return m_combination[j - 1]; };
+	auto c_next = [&](size_t j) noexcept -> size_t {
+		return j < t ? m_combination[j] : m_elements_number;
+	};
+	auto move = [&](size_t j, size_t value) noexcept {
+		removed = c(j);
+		added = value;
+		c(j) = value;
+	};
+
+	// easy case: move the first element
+	const bool odd = t % 2 == 1;
+	if(odd)
+	{
+		if(c(1) + 1 < c_next(1))
+		{
+			move(1, c(1) + 1);
+			return true;
+		}
+	}
+	else if(c(1) > 0)
+	{
+		move(1, c(1) - 1);
+		return true;
+	}
+
+	// try to decrease c(j) if the size is odd, to increase it otherwise, then alternate
+	bool decrease = odd;
+	for(size_t j = 2; j <= t; ++j)
+	{
+		if(decrease)
+		{
+			// c(j) = c(j - 1) + 1
+			if(c(j) >= j)
+			{
+				removed = c(j);
+				added = j - 2;
+				c(j) = c(j - 1);
+				c(j - 1) = j - 2;
+				return true;
+			}
+		}
+		else
+		{
+			// c(j - 1) = j - 2
+			if(c(j) + 1 < c_next(j))
+			{
+				removed = c(j - 1);
+				added = c(j) + 1;
+				c(j - 1) = c(j);
+				++c(j);
+				return true;
+			}
+		}
+		decrease = !decrease;
+	}
+	return false;
+}
+
+size_t binomial(size_t n, size_t k) noexcept
+{
+	if(k > n)
+	{
+		return 0;
+	}
+	k = std::min(k, n - k);
+	size_t result = 1;
+	for(size_t i = 1; i <= k; ++i)
+	{
+		// result * (n - k + i) / i without overflow: result is C(n - k + i - 1, i - 1)
+		const size_t factor = n - k + i;
+		const size_t gcd = std::gcd(result, i);
+		const size_t reduced_result = result / gcd;
+		const size_t reduced_factor = factor / (i / gcd);
+		if(reduced_result > std::numeric_limits<size_t>::max() / reduced_factor)
+		{
+			return std::numeric_limits<size_t>::max();
+		}
+		result = reduced_result * reduced_factor;
+	}
+	return result;
+}